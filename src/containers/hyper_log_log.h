@@ -0,0 +1,145 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace lipaboy_lib {
+
+	// INFO: HyperLogLog cardinality sketch (Flajolet, Fusy, Gandouet, Meunier).
+	//		 Keeps 2^precision one-byte registers: the first bits of hash choose register,
+	//		 the register keeps maximum position of the first set bit among the rest bits.
+	//		 Relative error is about 1.04 / sqrt(2^precision) (for precision 14 it is ~0.8% using 16 KB).
+	//		 Hash is 64-bit so large range correction is not needed,
+	//		 small range is corrected by linear counting.
+	//
+	//		 Sketches with the same precision are mergeable (register-wise maximum)
+	//		 and can be serialized into bytes: [version][precision][registers...].
+
+	class HyperLogLog {
+	public:
+		using size_type = size_t;
+		using RegisterType = uint8_t;
+		using HashType = uint64_t;
+		using BytesType = std::vector<uint8_t>;
+
+		static constexpr unsigned int MIN_PRECISION = 4;
+		static constexpr unsigned int MAX_PRECISION = 18;
+		static constexpr uint8_t SERIALIZATION_VERSION = 1;
+
+	public:
+		explicit
+			HyperLogLog(unsigned int precision = 14)
+				: precision_(precision)
+		{
+			if (precision < MIN_PRECISION || precision > MAX_PRECISION)
+				throw std::logic_error("HyperLogLog error: precision must be in range [4, 18]");
+			registers_.assign(size_type(1) << precision, 0);
+		}
+
+		// Info: hash must be well-mixed (all the bits are significant)
+		void addHash(HashType hash) {
+			const size_type index = size_type(hash >> (64 - precision_));
+			// sentinel bit bounds the rank if the rest bits are zeros
+			const HashType rest = (hash << precision_) | (HashType(1) << (precision_ - 1));
+			const RegisterType rank = RegisterType(leadingZeros(rest) + 1);
+			registers_[index] = std::max(registers_[index], rank);
+		}
+
+		template <class T, class Hash = std::hash<T> >
+		void add(T const & value, Hash hasher = Hash()) {
+			addHash(mix(HashType(hasher(value))));
+		}
+
+		// Info: sketches must have the same precision
+		void merge(HyperLogLog const & other) {
+			if (other.precision_ != precision_)
+				throw std::logic_error("HyperLogLog error: merging sketches with different precision");
+			for (size_type i = 0; i < registers_.size(); i++)
+				registers_[i] = std::max(registers_[i], other.registers_[i]);
+		}
+
+		double estimate() const {
+			const double m = double(registers_.size());
+			double harmonicSum = 0.;
+			size_type zeros = 0;
+			for (auto reg : registers_) {
+				harmonicSum += std::ldexp(1., -int(reg));
+				zeros += (reg == 0);
+			}
+			const double raw = alpha() * m * m / harmonicSum;
+			if (raw <= 2.5 * m && zeros > 0)
+				// linear counting
+				return m * std::log(m / double(zeros));
+			return raw;
+		}
+		uint64_t count() const { return uint64_t(std::llround(estimate())); }
+
+		unsigned int precision() const { return precision_; }
+		// memory of registers in bytes
+		size_type memory() const { return registers_.size() * sizeof(RegisterType); }
+
+		bool operator== (HyperLogLog const & other) const {
+			return precision_ == other.precision_ && registers_ == other.registers_;
+		}
+		bool operator!= (HyperLogLog const & other) const { return !(*this == other); }
+
+		//--------------Serialization------------//
+
+		BytesType serialize() const {
+			BytesType bytes;
+			bytes.reserve(2 + registers_.size());
+			bytes.push_back(SERIALIZATION_VERSION);
+			bytes.push_back(uint8_t(precision_));
+			bytes.insert(bytes.end(), registers_.begin(), registers_.end());
+			return bytes;
+		}
+
+		static HyperLogLog deserialize(BytesType const & bytes) {
+			if (bytes.size() < 2 || bytes[0] != SERIALIZATION_VERSION)
+				throw std::logic_error("HyperLogLog error: unknown serialization format");
+			HyperLogLog sketch(bytes[1]);
+			if (bytes.size() != 2 + sketch.registers_.size())
+				throw std::logic_error("HyperLogLog error: wrong size of serialized sketch");
+			std::copy(bytes.begin() + 2, bytes.end(), sketch.registers_.begin());
+			return sketch;
+		}
+
+	public:
+		// Info: std::hash of integers is identity in the most of implementations,
+		//		 so its result is mixed by finalizer of MurmurHash3.
+		static HashType mix(HashType hash) {
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccdull;
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ull;
+			hash ^= hash >> 33;
+			return hash;
+		}
+
+	private:
+		double alpha() const {
+			switch (registers_.size()) {
+			case 16: return 0.673;
+			case 32: return 0.697;
+			case 64: return 0.709;
+			default: return 0.7213 / (1. + 1.079 / double(registers_.size()));
+			}
+		}
+
+		static unsigned int leadingZeros(HashType value) {
+			unsigned int count = 0;
+			for (HashType mask = HashType(1) << 63; (value & mask) == 0; mask >>= 1)
+				count++;
+			return count;
+		}
+
+	private:
+		unsigned int precision_;
+		std::vector<RegisterType> registers_;
+	};
+
+}
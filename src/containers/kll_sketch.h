@@ -0,0 +1,182 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace lipaboy_lib {
+
+	// INFO: KLL quantile sketch (Karnin, Lang, Liberty - "Optimal Quantile Approximation in Streams").
+	//		 Keeps a hierarchy of compactors: element of level h has weight 2^h.
+	//		 When level overflows, it is sorted and every second element is promoted to the next level.
+	//		 Memory is O(k) (bounded), rank error is about 1.7 / k (for k = 200 it is ~1%).
+	//
+	//		 Coin for choosing the promoted half is pseudo-random with fixed seed so results are
+	//		 reproducible from run to run.
+	//
+	//		 All the compactors are allocated by the given allocator.
+
+	template <class T = double, class Allocator = std::allocator<T> >
+	class KLLSketch {
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using allocator_type = Allocator;
+		using CompactorType = std::vector<T, Allocator>;
+
+	private:
+		template <class U>
+		using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+	public:
+		explicit
+			KLLSketch(size_type k = 200, Allocator const & allocator = Allocator())
+				: k_(k), compactors_(RebindAllocator<CompactorType>(allocator))
+		{
+			if (k < 8)
+				throw std::logic_error("KLLSketch error: parameter k must be not less than 8");
+			addLevel();
+		}
+
+		void update(T const & value) {
+			compactors_[0].push_back(value);
+			count_++;
+			retained_++;
+			if (retained_ >= capacity_)
+				compress();
+		}
+
+		// Info: sketches must have the same k
+		void merge(KLLSketch const & other) {
+			if (other.k_ != k_)
+				throw std::logic_error("KLLSketch error: merging sketches with different k");
+			while (compactors_.size() < other.compactors_.size())
+				addLevel();
+			for (size_type h = 0; h < other.compactors_.size(); h++)
+				compactors_[h].insert(compactors_[h].end(),
+					other.compactors_[h].begin(), other.compactors_[h].end());
+			count_ += other.count_;
+			retained_ += other.retained_;
+			while (retained_ >= capacity_)
+				compress();
+		}
+
+		// q in [0, 1]. Returns T() for empty sketch.
+		T quantile(double q) const {
+			auto weighted = sortedWeightedValues();
+			if (weighted.empty())
+				return T();
+			q = std::clamp(q, 0., 1.);
+			const double rank = q * double(count_);
+			uint64_t cumulative = 0;
+			for (auto const & [value, weight] : weighted) {
+				cumulative += weight;
+				if (double(cumulative) >= rank)
+					return value;
+			}
+			return weighted.back().first;
+		}
+
+		// Approximate fraction of elements that are less or equal to value
+		double rank(T const & value) const {
+			if (count_ == 0)
+				return 0.;
+			uint64_t less = 0;
+			for (size_type h = 0; h < compactors_.size(); h++)
+				for (auto const & elem : compactors_[h])
+					if (!(value < elem))
+						less += uint64_t(1) << h;
+			return double(less) / double(count_);
+		}
+
+		allocator_type get_allocator() const { return allocator_type(compactors_.get_allocator()); }
+
+		uint64_t count() const { return count_; }
+		bool empty() const { return count_ == 0; }
+		size_type k() const { return k_; }
+		// count of stored elements (memory in units of T)
+		size_type retained() const { return retained_; }
+
+	private:
+		size_type levelCapacity(size_type level) const {
+			// c = 2/3: the upper level is the biggest one
+			const size_type depth = compactors_.size() - 1 - level;
+			return std::max<size_type>(2, size_type(std::ceil(double(k_) * std::pow(2. / 3., double(depth)))));
+		}
+
+		size_type computeCapacity() const {
+			size_type total = 0;
+			for (size_type h = 0; h < compactors_.size(); h++)
+				total += levelCapacity(h);
+			return total;
+		}
+
+		void compress() {
+			for (size_type h = 0; h < compactors_.size(); h++) {
+				if (compactors_[h].size() < levelCapacity(h))
+					continue;
+				if (h + 1 == compactors_.size())
+					addLevel();
+
+				auto & current = compactors_[h];
+				auto & upper = compactors_[h + 1];
+				std::sort(current.begin(), current.end());
+
+				// Info: odd element stays at the current level (its weight can't be halved)
+				T leftover{};
+				const bool hasLeftover = (current.size() % 2 == 1);
+				if (hasLeftover) {
+					leftover = std::move(current.back());
+					current.pop_back();
+				}
+				for (size_type i = nextCoin(); i < current.size(); i += 2)
+					upper.push_back(std::move(current[i]));
+				retained_ -= current.size() / 2;
+				current.clear();
+				if (hasLeftover)
+					current.push_back(std::move(leftover));
+				// lazy compaction: one level at a time is enough
+				return;
+			}
+		}
+
+		void addLevel() {
+			compactors_.emplace_back(CompactorType(get_allocator()));
+			capacity_ = computeCapacity();
+		}
+
+		size_type nextCoin() {
+			// xorshift64
+			seed_ ^= seed_ << 13;
+			seed_ ^= seed_ >> 7;
+			seed_ ^= seed_ << 17;
+			return size_type(seed_ & 1);
+		}
+
+		auto sortedWeightedValues() const {
+			using WeightedType = std::pair<T, uint64_t>;
+			std::vector<WeightedType, RebindAllocator<WeightedType> > weighted{
+				RebindAllocator<WeightedType>(get_allocator()) };
+			weighted.reserve(retained_);
+			for (size_type h = 0; h < compactors_.size(); h++)
+				for (auto const & elem : compactors_[h])
+					weighted.emplace_back(elem, uint64_t(1) << h);
+			std::sort(weighted.begin(), weighted.end(),
+				[](auto const & first, auto const & second) { return first.first < second.first; });
+			return weighted;
+		}
+
+	private:
+		size_type k_;
+		std::vector<CompactorType, RebindAllocator<CompactorType> > compactors_;
+		uint64_t count_ = 0;
+		size_type retained_ = 0;
+		size_type capacity_ = 0;
+		uint64_t seed_ = 0x9E3779B97F4A7C15ull;
+	};
+
+}
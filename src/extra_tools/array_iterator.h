@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+
+namespace lipaboy_lib {
+
+	//-----------------------------------------------------------------------//
+	//----------------------ITERATOR OVER INLINE ARRAY-----------------------//
+	//-----------------------------------------------------------------------//
+
+	// Info: owns the elements (inline std::array, without heap allocations) so it can be used
+	//		 in constant expressions. Elements are moved out by dereference.
+	//		 End is position-only sentinel (it's made by endIter()), so elements aren't duplicated.
+
+	struct ArraySentinel {
+		constexpr bool operator== (ArraySentinel) const { return true; }
+		constexpr bool operator!= (ArraySentinel) const { return false; }
+	};
+
+	template <class T, size_t N>
+	class ArrayIterator {
+	public:
+		using ContainerType = std::array<T, N>;
+		using value_type = T;
+		using reference = T & ;
+		using const_reference = T const &;
+		using pointer = T * ;
+		using const_pointer = T const *;
+		using iterator_category = std::input_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using size_type = size_t;
+		using sentinel_type = ArraySentinel;
+
+	public:
+		constexpr explicit ArrayIterator(ContainerType elems)
+			: elems_(elems), index_(0)
+		{}
+
+		constexpr value_type&& operator*() { return std::move(elems_[index_]); }
+		constexpr pointer operator->() { return &elems_[index_]; }
+
+		// Info: iterators own their elements, so equal positions aren't enough: the rest elements are compared
+		//		 (elements before the position are moved out already)
+		constexpr bool operator== (ArrayIterator const & other) const {
+			if (index_ != other.index_)
+				return false;
+			for (size_type i = index_; i < N; i++)
+				if (!(elems_[i] == other.elems_[i]))
+					return false;
+			return true;
+		}
+		constexpr bool operator!= (ArrayIterator const & other) const { return !((*this) == other); }
+		constexpr bool operator== (ArraySentinel) const { return index_ == N; }
+		constexpr bool operator!= (ArraySentinel) const { return index_ != N; }
+
+		constexpr ArrayIterator& operator++() {
+			++index_;
+			return *this;
+		}
+		// Info: without copy of elements (like input iterators of C++20)
+		constexpr void operator++(int) { ++index_; }
+
+		//------------Own API------------//
+
+		constexpr sentinel_type endIter() const { return sentinel_type(); }
+
+	private:
+		ContainerType elems_;
+		size_type index_;
+	};
+
+}
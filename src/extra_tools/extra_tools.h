@@ -50,7 +50,7 @@ struct RelativeForward {
 
 template <class RelativeToType, class ForwardingType>
 struct RelativeForward<RelativeToType&, ForwardingType> {
-static inline auto forward(
+static constexpr inline auto forward(
         std::remove_reference_t<ForwardingType>& t) noexcept
     -> std::remove_reference_t<ForwardingType>&
 {
@@ -60,7 +60,7 @@ static inline auto forward(
 
 template <class RelativeToType, class ForwardingType>
 struct RelativeForward<RelativeToType&&, ForwardingType> {
-static inline auto forward(
+static constexpr inline auto forward(
         std::remove_reference_t<ForwardingType>& t) noexcept
     -> std::remove_reference_t<ForwardingType>&&
 {
@@ -73,7 +73,7 @@ public:
 	}
 	bool operator!= (InitializerListIterator const & other) const { return !((*this) == other); }
 
-	InitializerListIterator operator++() {
+	InitializerListIterator& operator++() {
 		++subiter_;
 		return *this;
 	}
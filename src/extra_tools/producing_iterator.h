@@ -53,7 +53,7 @@ namespace lipaboy_lib {
 		}
 		bool operator!= (ProducingIterator & other) { return !((*this) == other); }
 
-		ProducingIterator operator++() {
+		ProducingIterator& operator++() {
 			*pCurrentElem_ = std::move(generator_());
 			return *this;
 		}
@@ -117,7 +117,7 @@ namespace lipaboy_lib {
 			}
 			bool operator!= (ProducingIterator2& other) { return !((*this) == other); }
 
-			ProducingIterator2 operator++() {
+			ProducingIterator2& operator++() {
 				elem_ = std::move(generator_());
 				return *this;
 			}
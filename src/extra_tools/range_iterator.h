@@ -0,0 +1,92 @@
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+
+namespace lipaboy_lib {
+
+	//-----------------------------------------------------------------------//
+	//------------------ITERATOR OVER ARITHMETIC PROGRESSION-----------------//
+	//-----------------------------------------------------------------------//
+
+	// Info: element is computed by its index (first + index * step), so there is
+	//		 no accumulation of error for floating types and jumps are O(1).
+	//		 Iterators are compared by index only.
+
+	template <class T>
+	class RangeIterator {
+	public:
+		using value_type = T;
+		using reference = T;
+		using const_reference = T;
+		using pointer = void;
+		using iterator_category = std::random_access_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+
+	public:
+		constexpr RangeIterator()
+			: first_(), step_(), index_(0)
+		{}
+		constexpr RangeIterator(T first, T step, difference_type index = 0)
+			: first_(first), step_(step), index_(index)
+		{}
+
+		constexpr value_type operator*() const {
+			// Info: integers are computed modulo 2^n (element itself is inside of range,
+			//		 but index * step can be out of range of signed T)
+			if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+				using Unsigned = std::make_unsigned_t<T>;
+				return static_cast<T>(static_cast<Unsigned>(first_)
+					+ static_cast<Unsigned>(index_) * static_cast<Unsigned>(step_));
+			}
+			else
+				return static_cast<T>(first_ + static_cast<T>(index_) * step_);
+		}
+		constexpr value_type operator[](difference_type n) const { return *(*this + n); }
+
+		constexpr bool operator== (RangeIterator const & other) const { return index_ == other.index_; }
+		constexpr bool operator!= (RangeIterator const & other) const { return !((*this) == other); }
+		constexpr bool operator< (RangeIterator const & other) const { return index_ < other.index_; }
+		constexpr bool operator> (RangeIterator const & other) const { return other < *this; }
+		constexpr bool operator<= (RangeIterator const & other) const { return !(other < *this); }
+		constexpr bool operator>= (RangeIterator const & other) const { return !(*this < other); }
+
+		constexpr RangeIterator& operator++() {
+			++index_;
+			return *this;
+		}
+		constexpr RangeIterator operator++(int) {
+			RangeIterator prev = *this;
+			++index_;
+			return prev;
+		}
+		constexpr RangeIterator& operator--() {
+			--index_;
+			return *this;
+		}
+		constexpr RangeIterator operator--(int) {
+			RangeIterator prev = *this;
+			--index_;
+			return prev;
+		}
+
+		constexpr RangeIterator& operator+= (difference_type n) {
+			index_ += n;
+			return *this;
+		}
+		constexpr RangeIterator& operator-= (difference_type n) {
+			index_ -= n;
+			return *this;
+		}
+		constexpr RangeIterator operator+ (difference_type n) const { return RangeIterator(first_, step_, index_ + n); }
+		constexpr RangeIterator operator- (difference_type n) const { return RangeIterator(first_, step_, index_ - n); }
+		constexpr difference_type operator- (RangeIterator const & other) const { return index_ - other.index_; }
+
+	private:
+		T first_;
+		T step_;
+		difference_type index_;
+	};
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+
+namespace lipaboy_lib {
+
+	// INFO: minimal non-owning view over contiguous memory (std::span appears only in C++20).
+	//		 It doesn't control lifetime of viewed elements - the owner must outlive it.
+
+	template <class T>
+	class span {
+	public:
+		using element_type = T;
+		using value_type = std::remove_cv_t<T>;
+		using size_type = size_t;
+		using pointer = T * ;
+		using reference = T & ;
+		using iterator = pointer;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+
+	public:
+		constexpr span() noexcept : data_(nullptr), size_(0) {}
+		constexpr span(pointer data, size_type size) noexcept : data_(data), size_(size) {}
+		// span<T> -> span<const T>
+		template <class U, class = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]> > >
+		constexpr span(span<U> const & other) noexcept : data_(other.data()), size_(other.size()) {}
+
+		constexpr pointer data() const noexcept { return data_; }
+		constexpr size_type size() const noexcept { return size_; }
+		constexpr bool empty() const noexcept { return size_ == 0; }
+
+		constexpr reference operator[](size_type index) const { return data_[index]; }
+		constexpr reference front() const { return data_[0]; }
+		constexpr reference back() const { return data_[size_ - 1]; }
+
+		constexpr iterator begin() const noexcept { return data_; }
+		constexpr iterator end() const noexcept { return data_ + size_; }
+		reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+		reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+	private:
+		pointer data_;
+		size_type size_;
+	};
+
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "long_numbers/long_unsigned.h"
+#include "long_numbers/long_number.h"
+#include "long_numbers/big_integer/big_unsigned.h"
+
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+
+namespace lipaboy_lib::long_numbers_space {
+
+	// INFO: input iterator over digits of long number in any base (from least to most significant).
+	//		 Digits are extracted by chunks: the whole number is divided (by short division) by the
+	//		 largest power of base that fits into 32-bit word, then the remainder (chunk) gives
+	//		 several digits by native divisions. So there is one long division per chunk, not per digit.
+	//		 Limbs are stored as 32-bit words in radix 2^32 (LongUnsigned, BigUnsigned)
+	//		 or 10^9 (LongIntegerDecimal). Sign of number is ignored.
+	//
+	//		 Default-constructed iterator is the end one.
+
+	class DigitsIterator {
+	public:
+		using WordType = std::uint32_t;
+		using DoubleWordType = std::uint64_t;
+		using ContainerType = std::vector<WordType>;
+		using size_type = size_t;
+
+		using value_type = WordType;
+		using reference = value_type const &;
+		using pointer = value_type const *;
+		using difference_type = std::ptrdiff_t;
+		using iterator_category = std::input_iterator_tag;
+
+	public:
+		DigitsIterator() : isEnd_(true) {}
+		// limbs - from least to most significant
+		DigitsIterator(ContainerType limbs, DoubleWordType radix, unsigned int base)
+			: limbs_(std::move(limbs)), radix_(radix), base_(base)
+		{
+			if (base < 2)
+				throw std::logic_error("DigitsIterator error: base must be not less than 2");
+			// largest power of base that fits into word
+			chunkDivisor_ = base;
+			chunkDigits_ = 1;
+			while (chunkDivisor_ * base <= DoubleWordType(std::numeric_limits<WordType>::max())) {
+				chunkDivisor_ *= base;
+				chunkDigits_++;
+			}
+			// Info: if radix is power of base (10^9 for 10, 2^32 for 2 or 16)
+			//		 then chunks are the limbs itself and no division is needed
+			if (isPowerOf(radix_, base)) {
+				chunkDivisor_ = radix_;
+				chunkDigits_ = digitsCountOf(radix_ - 1);
+			}
+
+			zapLeadingZeros();
+			if (!hasLimbs())
+				// zero number has one digit
+				digit_ = 0;
+			else
+				next();
+		}
+
+		value_type operator*() const { return digit_; }
+		pointer operator->() const { return &digit_; }
+
+		DigitsIterator& operator++() {
+			next();
+			return *this;
+		}
+		DigitsIterator operator++(int) {
+			DigitsIterator prev = *this;
+			next();
+			return prev;
+		}
+
+		bool operator== (DigitsIterator const & other) const {
+			if (isEnd_ || other.isEnd_)
+				return isEnd_ == other.isEnd_;
+			return digit_ == other.digit_
+				&& chunk_ == other.chunk_
+				&& chunkDigitsLeft_ == other.chunkDigitsLeft_
+				&& std::equal(limbs_.begin() + lowest_, limbs_.end(),
+					other.limbs_.begin() + other.lowest_, other.limbs_.end());
+		}
+		bool operator!= (DigitsIterator const & other) const { return !(*this == other); }
+
+		unsigned int base() const { return base_; }
+
+	private:
+		void next() {
+			if (chunkDigitsLeft_ == 0) {
+				if (!hasLimbs()) {
+					isEnd_ = true;
+					return;
+				}
+				chunk_ = extractChunk();
+				chunkDigitsLeft_ = chunkDigits_;
+			}
+			digit_ = WordType(chunk_ % base_);
+			chunk_ /= base_;
+			chunkDigitsLeft_--;
+			// the last chunk has no leading zeros
+			if (!hasLimbs() && chunk_ == 0)
+				chunkDigitsLeft_ = 0;
+		}
+
+		// divides the number by chunkDivisor_ and returns the remainder
+		WordType extractChunk() {
+			if (chunkDivisor_ == radix_) {
+				return limbs_[lowest_++];
+			}
+			DoubleWordType remainder = 0;
+			for (size_type i = limbs_.size(); i-- > lowest_; ) {
+				const DoubleWordType current = remainder * radix_ + limbs_[i];
+				limbs_[i] = WordType(current / chunkDivisor_);
+				remainder = current % chunkDivisor_;
+			}
+			zapLeadingZeros();
+			return WordType(remainder);
+		}
+
+		void zapLeadingZeros() {
+			while (hasLimbs() && limbs_.back() == 0)
+				limbs_.pop_back();
+		}
+		bool hasLimbs() const { return lowest_ < limbs_.size(); }
+
+		size_type digitsCountOf(DoubleWordType number) const {
+			size_type count = 0;
+			for (; number > 0; number /= base_)
+				count++;
+			return count;
+		}
+
+		static bool isPowerOf(DoubleWordType number, DoubleWordType root) {
+			while (number > 1 && number % root == 0)
+				number /= root;
+			return number == 1;
+		}
+
+	private:
+		ContainerType limbs_;
+		// limbs below it are already consumed (by the fast path)
+		size_type lowest_ = 0;
+		DoubleWordType radix_ = 0;
+		unsigned int base_ = 10;
+		DoubleWordType chunkDivisor_ = 0;
+		size_type chunkDigits_ = 0;
+
+		DoubleWordType chunk_ = 0;
+		size_type chunkDigitsLeft_ = 0;
+		value_type digit_ = 0;
+		bool isEnd_ = false;
+	};
+
+	//----------------------Making iterators---------------------//
+
+	template <LengthType length>
+	DigitsIterator makeDigitsIterator(LongUnsigned<length> const & number, unsigned int base = 10) {
+		DigitsIterator::ContainerType limbs(length);
+		for (size_t i = 0; i < length; i++)
+			limbs[i] = number[i];
+		return DigitsIterator(std::move(limbs),
+			DigitsIterator::DoubleWordType(1) << LongUnsigned<length>::integralModulusDegree(), base);
+	}
+
+	template <LengthType length>
+	DigitsIterator makeDigitsIterator(LongIntegerDecimal<length> const & number, unsigned int base = 10) {
+		return DigitsIterator(DigitsIterator::ContainerType(number.cbegin(), number.cend()),
+			LongIntegerDecimal<length>::integralModulus(), base);
+	}
+
+	inline DigitsIterator makeDigitsIterator(BigUnsigned const & number, unsigned int base = 10) {
+		using WordType = DigitsIterator::WordType;
+		using BlockType = BigUnsigned::BlockType;
+		constexpr size_t WORDS_PER_BLOCK = sizeof(BlockType) / sizeof(WordType);
+		constexpr unsigned int WORD_BITS = 8 * sizeof(WordType);
+
+		DigitsIterator::ContainerType limbs;
+		limbs.reserve(number.length() * WORDS_PER_BLOCK);
+		for (auto iter = number.cbegin(); iter != number.cend(); iter++) {
+			BlockType block = *iter;
+			for (size_t i = 0; i < WORDS_PER_BLOCK; i++) {
+				limbs.push_back(WordType(block));
+				if constexpr (WORDS_PER_BLOCK > 1)
+					block >>= WORD_BITS;
+			}
+		}
+		return DigitsIterator(std::move(limbs), DigitsIterator::DoubleWordType(1) << WORD_BITS, base);
+	}
+
+}
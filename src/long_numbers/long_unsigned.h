@@ -8,8 +8,11 @@
 #include <cmath>
 #include <tuple>        // std::pair
 #include <optional>
+#include <vector>
+#include <limits>
 
 #include <exception>
+#include <stdexcept>
 #include <ostream>
 #include <string_view>
 #include <charconv>
@@ -51,6 +54,14 @@ namespace lipaboy_lib::long_numbers_space {
         template <class TWord>
         inline constexpr size_t bitsCount() { return sizeof(TWord) * 8; }
 
+        template <class TWord>
+        inline constexpr unsigned int leadingZerosCount(TWord word) {
+            unsigned int count = unsigned(bitsCount<TWord>());
+            for (; word != 0; word >>= 1)
+                count--;
+            return count;
+        }
+
         //////////////////////////////////////////////////////////////////////////////////
         template <size_t val1, size_t val2>
         struct Max {
@@ -212,18 +223,27 @@ namespace lipaboy_lib::long_numbers_space {
 
             for (size_t i = 0; i < length(); i++)
             {
+                if ((*this)[i] == zeroIntegral())
+                    continue;
                 IntegralType remainder = zeroIntegral();
                 size_t j = 0;
                 for (; i + j < res.length(); j++)
                 {
                     if (j >= other.length()) {
-                        res[i + j] += remainder;
+                        // carry goes up until it's absorbed
+                        for (; i + j < res.length() && remainder != zeroIntegral(); j++) {
+                            const TIntegralResult dualTemp = TIntegralResult(res[i + j]) + remainder;
+                            res[i + j] = IntegralType(dualTemp & integralModulus());
+                            remainder = IntegralType(dualTemp >> integralModulusDegree());
+                        }
                         break;
                     }
 
-                    const TIntegralResult dualTemp = TIntegralResult((*this)[i]) * other[j] + remainder;
+                    // Info: it can't overflow: (2^32 - 1)^2 + 2 * (2^32 - 1) = 2^64 - 1
+                    const TIntegralResult dualTemp = TIntegralResult((*this)[i]) * other[j]
+                        + res[i + j] + remainder;
                     // Detail #2
-                    res[i + j] += IntegralType(dualTemp & integralModulus());
+                    res[i + j] = IntegralType(dualTemp & integralModulus());
                     remainder = IntegralType(dualTemp >> integralModulusDegree());
                 }
             }
@@ -255,60 +275,124 @@ namespace lipaboy_lib::long_numbers_space {
             return *this;
         }
 
+        // Info: word-level long division (Knuth's algorithm D, TAOCP vol. 2, 4.3.1).
+        //       Divider is normalized (its major word gets the major bit set), then every word
+        //       of quotient is estimated by dividing two major words of remainder by major word
+        //       of divider (64/32 bits) and corrected by the next word. After correction estimation
+        //       can be greater than true word by one (rarely), that is fixed by adding the divider back.
+        //       Complexity: O(m * n) word operations for m-word dividend and n-word divider.
         template <LengthType otherLen>
         auto divide(LongUnsigned<otherLen> const & other) const->pair<LongUnsigned, LongUnsigned>
         {
-            // TODO: replace to OneDigitNumber
-            const LongUnsigned<1> DEC(10);
-            const LongUnsigned<1> ONE(1);
-            const LongUnsigned<1> ZERO(0);
+            const LongUnsigned divider(other);
 
             #if (defined(WIN32) && defined(DEBUG_)) || (defined(__linux__) && !defined(NDEBUG))
-                if (other == ZERO) {
+                if (divider.isZero()) {
                     throw std::runtime_error("Runtime Error (LongUnsigned): division by zero");
                 }
             #endif
 
-            LongUnsigned quotient(0);
-            LongUnsigned dividend(*this);
-            LongUnsigned divider(other);
-            LongUnsigned modulus(1);
-
-            int dividendMajorBit = int(dividend.majorBitPosition().value_or(0));
-            int dividerMajorBit = int(divider.majorBitPosition().value_or(0));
-
-            int diff = dividendMajorBit - dividerMajorBit;
-            if (diff > 0) {
-                divider.shiftLeft(diff);
-                modulus.shiftLeft(diff);
-                if (divider > dividend) {
-                    divider.shiftRight(1);
-                    modulus.shiftRight(1);
-                }
+            const size_type n = divider.significantLength();
+            const size_type m = significantLength();
+            if (m < n)
+                return std::make_pair(LongUnsigned(0), *this);
+            if (n <= 1) {
+                auto res = divide(divider[0]);
+                return std::make_pair(res.first, LongUnsigned(res.second));
             }
 
-            while (dividend >= divider || modulus != ONE) {
-                while (dividend >= divider) {
-                    dividend -= divider;
-                    quotient += modulus;
-                }
+            constexpr TIntegralResult base = TIntegralResult(1) << integralModulusDegree();
+            const unsigned int shift = extra::leadingZerosCount(divider[n - 1]);
 
-                while (modulus != ONE) {
-                    divider.shiftRight(1);
-                    modulus.shiftRight(1);
-                    if (divider <= dividend)
+            // normalized divider and remainder (remainder has one extra word for shifted out bits)
+            array<IntegralType, lengthOfIntegrals> v;
+            array<IntegralType, lengthOfIntegrals + 1> u;
+            for (size_type i = n - 1; i > 0; i--)
+                v[i] = shiftedWord(divider[i], divider[i - 1], shift);
+            v[0] = IntegralType(divider[0] << shift);
+            u[m] = shiftedWord(zeroIntegral(), (*this)[m - 1], shift);
+            for (size_type i = m - 1; i > 0; i--)
+                u[i] = shiftedWord((*this)[i], (*this)[i - 1], shift);
+            u[0] = IntegralType((*this)[0] << shift);
+
+            LongUnsigned quotient(0);
+            for (size_type j = m - n + 1; j-- > 0; ) {
+                // estimation of quotient's word
+                const TIntegralResult numerator = (TIntegralResult(u[j + n]) << integralModulusDegree()) | u[j + n - 1];
+                TIntegralResult qhat = numerator / v[n - 1];
+                TIntegralResult rhat = numerator % v[n - 1];
+                while (qhat >= base
+                    || qhat * v[n - 2] > ((rhat << integralModulusDegree()) | u[j + n - 2]))
+                {
+                    qhat--;
+                    rhat += v[n - 1];
+                    if (rhat >= base)
                         break;
                 }
+
+                // u[j..j+n] -= qhat * v
+                TSignedResult borrow = 0;
+                TSignedResult temp = 0;
+                for (size_type i = 0; i < n; i++) {
+                    const TIntegralResult product = qhat * v[i];
+                    temp = TSignedResult(u[i + j]) - borrow - TSignedResult(product & integralModulus());
+                    u[i + j] = IntegralType(temp);
+                    borrow = TSignedResult(product >> integralModulusDegree()) - (temp >> integralModulusDegree());
+                }
+                temp = TSignedResult(u[j + n]) - borrow;
+                u[j + n] = IntegralType(temp);
+
+                quotient[j] = IntegralType(qhat);
+                // estimation was greater by one: add the divider back
+                if (temp < 0) {
+                    quotient[j]--;
+                    TIntegralResult carry = 0;
+                    for (size_type i = 0; i < n; i++) {
+                        const TIntegralResult sum = TIntegralResult(u[i + j]) + v[i] + carry;
+                        u[i + j] = IntegralType(sum);
+                        carry = sum >> integralModulusDegree();
+                    }
+                    u[j + n] = IntegralType(u[j + n] + carry);
+                }
             }
-            // dividend - it is equal to remainder of division
 
-            return std::make_pair(quotient, dividend);
+            // denormalization of remainder
+            LongUnsigned remainder(0);
+            for (size_type i = 0; i + 1 < n; i++)
+                remainder[i] = IntegralType(((TIntegralResult(u[i + 1]) << integralModulusDegree()) | u[i]) >> shift);
+            remainder[n - 1] = IntegralType(u[n - 1] >> shift);
+
+            return std::make_pair(quotient, remainder);
         }
+
+        // Info: division by one word (the fast path of division), returns quotient and remainder
+        auto divide(IntegralType divider) const -> pair<LongUnsigned, IntegralType>
+        {
+            #if (defined(WIN32) && defined(DEBUG_)) || (defined(__linux__) && !defined(NDEBUG))
+                if (divider == zeroIntegral()) {
+                    throw std::runtime_error("Runtime Error (LongUnsigned): division by zero");
+                }
+            #endif
+
+            LongUnsigned quotient(0);
+            TIntegralResult remainder = 0;
+            for (size_type i = significantLength(); i-- > 0; ) {
+                const TIntegralResult current = (remainder << integralModulusDegree()) | (*this)[i];
+                quotient[i] = IntegralType(current / divider);
+                remainder = current % divider;
+            }
+            return std::make_pair(quotient, IntegralType(remainder));
+        }
+
         const_reference shiftLeft(unsigned int count);
         const_reference shiftRight(unsigned int count);
 
         //-------------Converter---------------//
 
+        // Info: digits of bases greater than 10 are lowercase latin letters (base must be in [2, 36]).
+        //       Number is divided by the greatest power of base that fits into word (10^9 for decimal)
+        //       and every division gives several digits. Long numbers are split into halves
+        //       by precomputed powers of base (divide and conquer) before that.
         string to_string(unsigned int base = 10) const;
 
         //------------Setters, Getters----------//
@@ -437,6 +521,14 @@ namespace lipaboy_lib::long_numbers_space {
         bool operator<= (LongUnsigned<otherLen> const& other) const { return !(*this > other); }
 
     public:
+        // count of words without leading zero words
+        size_type significantLength() const {
+            size_type len = length();
+            while (len > 0 && (*this)[len - 1] == zeroIntegral())
+                len--;
+            return len;
+        }
+
         auto majorBitPosition() const
             -> std::optional<size_type>
         {
@@ -465,7 +557,33 @@ namespace lipaboy_lib::long_numbers_space {
         }
 
     private:
+        // numbers longer than this count of words are converted to string by divide and conquer
+        static constexpr size_type TO_STRING_SPLIT_LENGTH = 32;
+
+        // appends digits of number padded by zeros to width
+        static void appendDigits(string & res, LongUnsigned const & number, unsigned int base, size_type width);
+        static void appendDigits(string & res, LongUnsigned const & number, unsigned int base, size_type width,
+            std::vector<LongUnsigned> const & powers, size_type level, size_type chunkDigits);
+
+        // number = number * factor + addend, where only 'used' minor words of number are nonzero
+        // (it's updated), the major carry is thrown away if number is full
+        void multiplyAdd(IntegralType factor, IntegralType addend, size_type & used) {
+            IntegralType carry = addend;
+            for (size_type i = 0; i < used; i++) {
+                const TIntegralResult dualTemp = TIntegralResult(number_[i]) * factor + carry;
+                number_[i] = IntegralType(dualTemp & integralModulus());
+                carry = IntegralType(dualTemp >> integralModulusDegree());
+            }
+            if (carry != zeroIntegral() && used < length())
+                number_[used++] = carry;
+        }
+
         static constexpr IntegralType zeroIntegral() { return IntegralType(0); }
+        // major word shifted left by 'shift' bits with the major bits of minor word (shift can be 0 to 32)
+        static constexpr IntegralType shiftedWord(IntegralType major, IntegralType minor, unsigned int shift) {
+            return IntegralType(((TIntegralResult(major) << integralModulusDegree() | minor) << shift)
+                >> integralModulusDegree());
+        }
 
     protected:
         iterator begin() { return number_.begin(); }
@@ -492,6 +610,42 @@ namespace lipaboy_lib::long_numbers_space {
     //-------------------------------      Methods     -----------------------------------------//
     //------------------------------------------------------------------------------------------//
 
+    namespace extra {
+
+        // Info: the greatest power of base that fits into word and its exponent
+        template <class TWord>
+        inline pair<TWord, size_t> maxWordPower(unsigned int base) {
+            uint64_t power = base;
+            size_t degree = 1;
+            while (power * base <= std::numeric_limits<TWord>::max()) {
+                power *= base;
+                degree++;
+            }
+            return std::make_pair(TWord(power), degree);
+        }
+
+        inline void checkBase(unsigned int base) {
+            if (base < 2 || base > 36)
+                throw std::runtime_error("Runtime Error (LongUnsigned): base must be in [2, 36]");
+        }
+
+        inline char digitChar(unsigned int digit) {
+            return "0123456789abcdefghijklmnopqrstuvwxyz"[digit];
+        }
+
+        // value of digit in any base up to 36 (letters in both cases), 36 for any other character
+        inline unsigned int digitValue(char symbol) {
+            if (symbol >= '0' && symbol <= '9')
+                return unsigned(symbol - '0');
+            if (symbol >= 'a' && symbol <= 'z')
+                return unsigned(symbol - 'a') + 10;
+            if (symbol >= 'A' && symbol <= 'Z')
+                return unsigned(symbol - 'A') + 10;
+            return 36;
+        }
+
+    }
+
     template <LengthType length>
     LongUnsigned<length>::LongUnsigned(string const& numberStr, unsigned int base)
     {
@@ -502,45 +656,37 @@ namespace lipaboy_lib::long_numbers_space {
             assignStr(numberStr, base);
     }
 
+    // Info: digits are taken by chunks that fit into word (9 decimal digits, 31 binary ones and etc.)
+    //       and every chunk is put by one pass: number = number * base^chunkDigits + chunk.
+    //       Pass goes only through significant words, so complexity is O(n^2 / chunkDigits)
+    //       word operations for n-word number. Number that doesn't fit is taken modulo 2^(32 * length()).
     template <LengthType length>
     void LongUnsigned<length>::assignStr(string const& numberStr, unsigned int base) {
         // TODO: add exception for zero length
         if (numberStr.length() > 0) {
-            const int integralModulusDegreeOfBase =
-                int(std::log(2) / std::log(base) * integralModulusDegree());
+            extra::checkBase(base);
 
             std::string_view numStrView = numberStr;
             numStrView.remove_prefix(
                 cutOffLeftBorder<int>(0, int(numStrView.find_first_not_of(" ")))
             );
-            // round the number by integral modulus
-            numStrView.remove_prefix(
-                cutOffLeftBorder<int>(0, int(numStrView.length()) - int(integralModulusDegreeOfBase * length()))
-            );
-
-            int blockLen = (base == 2) ? integralModulusDegreeOfBase - 1 : integralModulusDegreeOfBase;
-            int last = int(numStrView.length());        // last variable is not included into segment [0, len - 1]
-            int first = cutOffLeftBorder<int>(last - blockLen, 0);
-            LongUnsigned<length()> iBase = 1;
-            int subInt;
+            size_type digitsCount = 0;
+            while (digitsCount < numStrView.size() && extra::digitValue(numStrView[digitsCount]) < base)
+                digitsCount++;
 
             std::fill(begin(), end(), zeroIntegral());
-            while (last - first > 0) {
-                auto sub = numStrView.substr(size_t(first), size_t(last) - size_t(first));
-                std::from_chars(sub.data(), sub.data() + sub.size(), subInt, base);
-
-                subInt = std::abs(subInt);
-                auto jBase = iBase;
-                while (subInt > 0) {
-                    (*this) += LongUnsigned<1>(subInt % base) * jBase;
-                    jBase *= LongUnsigned<1>(base);
-                    subInt /= base;
-                }
-
-                iBase *= special::pow< LongUnsigned<1>, int, LongUnsigned<length()> >
-                    (LongUnsigned<1>(base), last - first);
-                last -= blockLen;
-                first = cutOffLeftBorder<int>(first - blockLen, 0);
+            if (digitsCount == 0)
+                return;
+
+            const auto [chunkPower, chunkDigits] = extra::maxWordPower<IntegralType>(base);
+            size_type used = 0;
+            // the first chunk is the shortest one, so the rest ones are full
+            size_type chunkLen = (digitsCount - 1) % chunkDigits + 1;
+            for (size_type pos = 0; pos < digitsCount; pos += chunkLen, chunkLen = chunkDigits) {
+                IntegralType chunk = zeroIntegral();
+                for (size_type j = pos; j < pos + chunkLen; j++)
+                    chunk = chunk * base + IntegralType(extra::digitValue(numStrView[j]));
+                multiplyAdd(chunkPower, chunk, used);
             }
         }
     }
@@ -602,19 +748,74 @@ namespace lipaboy_lib::long_numbers_space {
 
     template <size_t length>
     string LongUnsigned<length>::to_string(unsigned int base) const {
-        string res = "";
-        LongUnsigned temp = *this;
-        int i = 0;
-        //constexpr size_t digitsCount = extra::getIntegralModulusDegree<rank>();
+        extra::checkBase(base);
+        string res;
+        appendDigits(res, *this, base, 0);
+        return res;
+    }
+
+    template <size_t length>
+    void LongUnsigned<length>::appendDigits(string & res, LongUnsigned const & number,
+        unsigned int base, size_type width)
+    {
+        const auto [chunkPower, chunkDigits] = extra::maxWordPower<IntegralType>(base);
+
+        if (number.significantLength() > TO_STRING_SPLIT_LENGTH) {
+            // powers[i] = chunkPower^(2^i), it has chunkDigits * 2^i digits
+            std::vector<LongUnsigned> powers(1, LongUnsigned(chunkPower));
+            while (2 * powers.back().significantLength() <= length() && !(number < powers.back()))
+                powers.push_back(powers.back() * powers.back());
+            appendDigits(res, number, base, width, powers, powers.size() - 1, chunkDigits);
+            return;
+        }
+
+        // chunks from minor to major
+        std::vector<IntegralType> chunks;
+        chunks.reserve(number.significantLength() + 1);
+        LongUnsigned temp = number;
         do {
-            auto pair = temp.divide(LongUnsigned(base));
-            temp = pair.first;
-            res += std::to_string((pair.second)[0]);
-            i++;
-        } while (temp > LongUnsigned<1>(0));
-        return std::string(res.rbegin(), res.rend());
+            auto division = temp.divide(chunkPower);
+            temp = division.first;
+            chunks.push_back(division.second);
+        } while (!temp.isZero());
+
+        size_type majorDigits = 0;
+        for (IntegralType major = chunks.back(); major > 0; major /= base)
+            majorDigits++;
+        const size_type digits = std::max<size_type>(1, (chunks.size() - 1) * chunkDigits + majorDigits);
+        if (width > digits)
+            res.append(width - digits, '0');
+
+        size_type pos = res.size();
+        res.append(digits, '0');
+        for (size_type i = chunks.size(); i-- > 0; ) {
+            const size_type count = (i + 1 == chunks.size()) ? std::max<size_type>(1, majorDigits) : chunkDigits;
+            IntegralType chunk = chunks[i];
+            for (size_type j = count; j-- > 0; chunk /= base)
+                res[pos + j] = extra::digitChar(chunk % base);
+            pos += count;
+        }
     }
 
+    template <size_t length>
+    void LongUnsigned<length>::appendDigits(string & res, LongUnsigned const & number,
+        unsigned int base, size_type width,
+        std::vector<LongUnsigned> const & powers, size_type level, size_type chunkDigits)
+    {
+        if (number.significantLength() <= TO_STRING_SPLIT_LENGTH) {
+            appendDigits(res, number, base, width);
+            return;
+        }
+        while (level > 0 && number < powers[level])
+            level--;
+        // number = high * powers[level] + low, low has exactly lowDigits digits (with leading zeros)
+        const size_type lowDigits = chunkDigits << level;
+        auto division = number.divide(powers[level]);
+        const size_type highWidth = (width > lowDigits) ? width - lowDigits : 0;
+        if (!division.first.isZero() || highWidth > 0)
+            appendDigits(res, division.first, base, highWidth, powers, level, chunkDigits);
+        appendDigits(res, division.second, base, lowDigits, powers, level, chunkDigits);
+    }
 
     template <size_t length>
     std::ostream& operator<<(std::ostream & out, LongUnsigned<length> number) {
@@ -5,6 +5,7 @@
 
 #include "long_digits_multiplication_searching.h"
 #include "stream/stream.h"
+#include "stream/digits.h"
 
 namespace lipaboy_lib::numberphile {
 
@@ -102,28 +103,17 @@ namespace lipaboy_lib::numberphile {
             if (twos == 2 && threes == 3 && sevens == 14)
                 bool kek = true;
 
-            // TODO: need optimization!
             int64_t iNum = 0;
             for (; ; iNum++) {
-                nums[iNum + 1] = IntType(1);
-
-                auto curr = nums[iNum];
-                OneDigitIntType remainder;
-                int i;
-                for (i = int(curr.length()) - 1; curr[i] <= 0; i--) {}
-
-                for(auto part = curr[i]; part > 0; part /= 10) {
-                    remainder = part % 10;
-                    nums[iNum + 1] *= remainder;
-                }
-                for (i--; i >= 0; i--) {
-                    auto part = curr[i];
-                    for(uint32_t j = 0; j < IntType::integralModulusDegree(); j++) {
-                        remainder = part % 10;
-                        nums[iNum + 1] *= remainder;
-                        part /= 10;
-                    }
-                }
+                // product of digits
+                nums[iNum + 1] = (stream_space::digits(nums[iNum])
+                    | stream_space::reduce(
+                        [](IntType product, uint32_t digit) {
+                            product *= OneDigitIntType(int(digit));
+                            return product;
+                        },
+                        [](uint32_t digit) { return IntType(int(digit)); })
+                    ).value();
 
                 if (nums[iNum + 1] < DEC)
                     break;
@@ -353,18 +343,17 @@ namespace lipaboy_lib::numberphile {
                     maxNumber += OneDigitNumType(9);
                 }
             };
-            // TODO: need optimization!
             int64_t iNum = 0;
             for (; ; iNum++) {
-                nums[iNum + 1] = NumType(1);
-
-                auto curr = nums[iNum];
-                // TODO: optimize: make divide method with self-altering (/=, but with returning remainder)
-                while(curr > ZERO) {
-                    auto res = curr.divide(NumType(10));
-                    nums[iNum + 1] *= res.second;
-                    curr = res.first;
-                }
+                // product of digits
+                nums[iNum + 1] = (stream_space::digits(nums[iNum])
+                    | stream_space::reduce(
+                        [](NumType product, uint32_t digit) {
+                            product *= OneDigitNumType(digit);
+                            return product;
+                        },
+                        [](uint32_t digit) { return NumType(digit); })
+                    ).value();
 
                 if (nums[iNum + 1] < DEC)
                     break;
@@ -681,11 +670,11 @@ namespace lipaboy_lib::numberphile {
 
             cout << "Max steps: " << maxSteps << endl
                     << "Number: ";
-        auto vec = Stream(maxElem)
-                    | map([](char ch) -> int { return int(ch); })
-            | get(sizes[0])
-            | to_vector();
-        (Stream(vec.rbegin(), vec.rend()) | print_to(cout)) << endl;
+        auto digitsCount = std::min<size_t>(maxElem.size(), sizes[0]);
+        (Stream(maxElem.cbegin(), maxElem.cbegin() + digitsCount)
+            | reverse()
+            | map([](char ch) -> int { return int(ch); })
+            | print_to(cout)) << endl;
 
         cout << "Time elapsed: " << extra::diffFromNow(startTime) << endl;
 
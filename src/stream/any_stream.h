@@ -0,0 +1,200 @@
+#pragma once
+
+#include "light_stream.h"
+
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	// INFO: AnyStream<T> erases the type of pipeline which gives elements of type T.
+	//		 It can be returned from functions and stored into containers:
+	//			AnyStream<int> odds = Stream(vec) | filter(isOdd);
+	//			auto squares = std::move(odds) | map(square) | to_vector();
+	//		 Elements are pulled from the pipeline by batches (one virtual call per batch)
+	//		 into a buffer that is allocated once, so there are no allocations per element.
+	//		 Elements are moved out of the buffer, so move-only elements are supported.
+	//		 AnyStream<T> is move-only. CopyableAnyStream<T> can be copied (the copy clones
+	//		 the erased pipeline), it requires copyable pipeline at construction.
+	//		 Only finite streams can be erased (use get() before erasing of infinite stream).
+
+	struct AnySentinel {
+		bool operator== (AnySentinel) const { return true; }
+		bool operator!= (AnySentinel) const { return false; }
+	};
+
+	template <class T, bool isCopyable = false>
+	class AnyIterator {
+	public:
+		using value_type = T;
+		using reference = T & ;
+		using const_reference = T const &;
+		using pointer = T * ;
+		using const_pointer = T const *;
+		using iterator_category = std::input_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using size_type = size_t;
+		using sentinel_type = AnySentinel;
+
+	private:
+		// Info: buffer of default constructible elements is sized once and filled by index,
+		//		 other elements are appended to the reserved buffer.
+		static constexpr bool isBufferFilledByIndex() { return std::is_default_constructible_v<T>; }
+
+		// Info: batch buffer is kept by erased pipeline (not by iterator), so address of iterator
+		//		 doesn't escape to virtual call and its position can stay in register.
+		struct Concept {
+			virtual ~Concept() = default;
+			// Info: puts at most 'count' elements into the buffer and returns their count
+			virtual size_type pull(size_type count) = 0;
+			virtual std::unique_ptr<Concept> clone() const = 0;
+
+			std::vector<T> buffer;
+		};
+
+		template <class TStream>
+		struct Model : Concept {
+			Model(TStream stream) : stream_(std::move(stream)) {}
+
+			size_type pull(size_type count) override {
+				auto& buffer = this->buffer;
+				size_type i = 0;
+				if constexpr (isBufferFilledByIndex()) {
+					T* elems = buffer.data();
+					// size of random access stream is known, so batch is filled without checks
+					if constexpr (TStream::isRandomAccess()) {
+						size_type size = std::min(count, stream_.restSize());
+						for (; i < size; i++)
+							elems[i] = stream_.nextElem();
+					}
+					else {
+						for (; i < count && stream_.hasNext(); i++)
+							elems[i] = stream_.nextElem();
+					}
+				}
+				else {
+					buffer.clear();
+					for (; i < count && stream_.hasNext(); i++)
+						buffer.push_back(stream_.nextElem());
+				}
+				return i;
+			}
+			std::unique_ptr<Concept> clone() const override {
+				if constexpr (isCopyable)
+					return std::make_unique<Model>(*this);
+				else
+					return nullptr;
+			}
+
+			TStream stream_;
+		};
+
+		// Info: copying of pipeline (it's copy constructible only for copyable AnyIterator)
+		class ClonedPtr : public std::unique_ptr<Concept> {
+		public:
+			using Base = std::unique_ptr<Concept>;
+			using Base::Base;
+
+			ClonedPtr(ClonedPtr const & obj) : Base((obj == nullptr) ? nullptr : obj->clone()) {}
+			ClonedPtr(ClonedPtr&& obj) noexcept = default;
+			ClonedPtr& operator=(ClonedPtr const & obj) {
+				ClonedPtr temp(obj);
+				return (*this) = std::move(temp);
+			}
+			ClonedPtr& operator=(ClonedPtr&& obj) noexcept = default;
+		};
+		using ImplPtr = std::conditional_t<isCopyable, ClonedPtr, std::unique_ptr<Concept> >;
+
+	public:
+		template <class TStream>
+		AnyIterator(TStream stream, size_type batchSize)
+			: pImpl_(std::make_unique<Model<TStream> >(std::move(stream))),
+			batchSize_(batchSize),
+			pos_(0)
+		{
+			static_assert(!isCopyable || std::is_copy_constructible_v<TStream>,
+				"Stream error: copyable AnyStream requires copyable stream");
+			if (batchSize == 0)
+				throw std::logic_error("Parameter of AnyStream (batch size) must be positive");
+			if constexpr (isBufferFilledByIndex())
+				pImpl_->buffer.resize(batchSize);
+			else
+				pImpl_->buffer.reserve(batchSize);
+		}
+
+		// Info: element is read in place from the batch. The batch is pulled by comparison with end
+		//		 (hasNext of stream), so hot path costs one comparison of indices per element.
+		value_type&& operator*() { return std::move(pImpl_->buffer[pos_]); }
+		pointer operator->() { return &pImpl_->buffer[pos_]; }
+
+		bool operator== (AnySentinel) { return !hasElem(); }
+		bool operator!= (AnySentinel) { return hasElem(); }
+
+		AnyIterator& operator++() {
+			++pos_;
+			return *this;
+		}
+
+		//------------Own API------------//
+
+		size_type batchSize() const { return batchSize_; }
+
+	private:
+		// Info: returns false if the erased stream is over
+		bool hasElem() { return pos_ < size_ || pull(); }
+		bool pull() {
+			// moved-from stream is empty
+			if (pImpl_ == nullptr)
+				return false;
+			pos_ = 0;
+			size_ = pImpl_->pull(batchSize_);
+			return size_ > 0;
+		}
+
+	private:
+		ImplPtr pImpl_;
+		size_type batchSize_;
+		// position and size of buffer
+		size_type pos_;
+		size_type size_ = 0;
+	};
+
+	template <class T, bool isCopyable = false>
+	class AnyStream : public StreamBase<AnyIterator<T, isCopyable> > {
+	public:
+		using Base = StreamBase<AnyIterator<T, isCopyable> >;
+		using size_type = size_t;
+
+		static constexpr size_type DEFAULT_BATCH_SIZE = 64;
+
+	public:
+		template <class TStream, class = std::enable_if_t<
+			shortening::IsStream_v<TStream>
+			&& !std::is_base_of_v<Base, std::remove_reference_t<TStream> > > >
+		AnyStream(TStream&& stream, size_type batchSize = DEFAULT_BATCH_SIZE)
+			: Base(AnyIterator<T, isCopyable>(std::forward<TStream>(stream), batchSize),
+				AnySentinel())
+		{
+			using StreamType = std::remove_cv_t<std::remove_reference_t<TStream> >;
+			static_assert(!StreamType::isInfinite(),
+				"Stream error: attempt to erase type of infinite stream");
+			static_assert(std::is_convertible_v<typename StreamType::ResultValueType, T>,
+				"Stream error: elements of erased stream are not convertible to AnyStream's type");
+		}
+	};
+
+	template <class T>
+	using CopyableAnyStream = AnyStream<T, true>;
+
+	namespace shortening {
+
+		template <class T, bool isCopyable>
+		struct IsStream<AnyStream<T, isCopyable> > : std::true_type {};
+
+	}
+
+}
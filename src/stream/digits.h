@@ -0,0 +1,38 @@
+#pragma once
+
+#include "light_stream.h"
+#include "long_numbers/digits_iterator.h"
+
+namespace lipaboy_lib::stream_space {
+
+	// INFO: sources of digits of long numbers. Digits go from least to most significant
+	//		 without leading zeros (zero number gives one digit 0).
+	//		 Example: digits(number) | reduce([](auto prod, auto d) { return prod * d; })
+	//
+	//		 Digits are extracted by word-sized chunks (see "long_numbers/digits_iterator.h").
+
+	using long_numbers_space::DigitsIterator;
+
+	using StreamOfDigits = StreamOfOutsideIterators<DigitsIterator>;
+
+	template <long_numbers_space::LengthType length>
+	auto digits(long_numbers_space::LongUnsigned<length> const & number, unsigned int base = 10)
+		-> StreamOfDigits
+	{
+		return Stream(long_numbers_space::makeDigitsIterator(number, base), DigitsIterator());
+	}
+
+	template <long_numbers_space::LengthType length>
+	auto digits(long_numbers_space::LongIntegerDecimal<length> const & number, unsigned int base = 10)
+		-> StreamOfDigits
+	{
+		return Stream(long_numbers_space::makeDigitsIterator(number, base), DigitsIterator());
+	}
+
+	inline auto digits(long_numbers_space::BigUnsigned const & number, unsigned int base = 10)
+		-> StreamOfDigits
+	{
+		return Stream(long_numbers_space::makeDigitsIterator(number, base), DigitsIterator());
+	}
+
+}
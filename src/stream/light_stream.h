@@ -6,6 +6,7 @@
 
 #include "extra_tools/initializer_list_iterator.h"
 #include "extra_tools/producing_iterator.h"
+#include "extra_tools/array_iterator.h"
 
 #include <type_traits>
 
@@ -48,6 +49,9 @@ namespace lipaboy_lib::stream_space {
 		//typename std::initializer_list<T>::iterator
 	>;
 
+	template <class T, size_t N>
+	using StreamOfArray = StreamBase<ArrayIterator<T, N> >;
+
 	template <class Generator>
 	using StreamOfGenerator = StreamBase<ProducingIterator<typename std::result_of<Generator(void)>::type> >;
 
@@ -68,11 +72,17 @@ namespace lipaboy_lib::stream_space {
 		return StreamOfInitializingList<T>(init);
 	}
 
+	// Info: literal elements of trivial types are kept inline (std::array) so such a stream
+	//		 can be used in constant expressions. Other elements are kept into shared container.
 	template <class T, class... Args>
-	auto Stream(T elem, Args... args)
-		-> StreamOfInitializingList<T>
+	constexpr auto Stream(T elem, Args... args)
 	{
-		return StreamOfInitializingList<T>({ elem, args... });
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			ArrayIterator<T, 1 + sizeof...(Args)> begin(std::array<T, 1 + sizeof...(Args)>{ elem, args... });
+			return StreamOfArray<T, 1 + sizeof...(Args)>(begin, begin.endIter());
+		}
+		else
+			return StreamOfInitializingList<T>({ elem, args... });
 	}
 
 	// Note: such approach doesn't match for second constructor. 
@@ -155,64 +165,91 @@ namespace lipaboy_lib::stream_space {
 	// You cannot union these functions into one with Forward semantics because it will be too generalized
 	// Example (this function will apply for such expression: std::ios::in | std::ios::out)
 
+	// INFO: return type is deduced (not spelled by trailing return type) because it is a part
+	//		 of mangled name of operator| and it contains the whole stream type (twice).
+
 	namespace shortening {
 
-		template <class TOperator, class... Args>
-		using ExtendingReturnType =
-			lipaboy_lib::enable_if_else_t<std::is_base_of_v<operators::TerminatedOperator, TOperator>,
-			// terminated
-			typename shortening::TerminatedOperatorTypeApply_t<StreamBase<Args...>, TOperator>
-			::template RetType<typename StreamBase<Args...>::ResultValueType>,
-			// non-terminated
-			shortening::StreamTypeExtender_t<StreamBase<Args...>, TOperator>
-			>;
+		// Info: stream is replayable if its source is replayable and all its operators are stateless
+		template <class TStream>
+		struct IsReplayableStream : std::false_type {};
+		template <class TIterator>
+		struct IsReplayableStream<StreamBase<TIterator> > : IsReplayableIterator<TIterator> {};
+		template <class TOperator, class First, class... Rest>
+		struct IsReplayableStream<StreamBase<TOperator, First, Rest...> >
+			: std::bool_constant<std::is_base_of_v<operators::StatelessOperator, TOperator>
+				&& IsReplayableStream<StreamBase<First, Rest...> >::value>
+		{};
 
 	}
 
 	template <class TOperator, class... Args>
-	auto operator| (StreamBase<Args...>& stream, TOperator operation)
-		-> shortening::ExtendingReturnType<TOperator, Args...>
+	constexpr decltype(auto) operator| (StreamBase<Args...>& stream, TOperator operation)
 	{
 		using StreamType = StreamBase<Args...>;
 
 		if constexpr (std::is_base_of_v<operators::TerminatedOperator, TOperator>) {
-			stream.template assertOnInfinite<StreamType>();
-			return shortening::TerminatedOperatorTypeApply_t<StreamType, TOperator>
-				(operation).apply(stream);
+			if constexpr (!std::is_base_of_v<operators::ShortCircuitOperator, TOperator>)
+				stream.template assertOnInfinite<StreamType>();
+			if constexpr (shortening::IsReplayableStream<StreamType>::value) {
+				// INFO: l-value replayable stream isn't consumed, so it can be reused by other terminals
+				StreamType copy = stream;
+				return shortening::TerminatedOperatorTypeApply_t<StreamType, TOperator>
+					(operation).apply(copy);
+			}
+			else
+				return shortening::TerminatedOperatorTypeApply_t<StreamType, TOperator>
+					(operation).apply(stream);
 		}
 		else {
-			return shortening::StreamTypeExtender_t<StreamType, TOperator>
-				(operation, stream);
+			return shortening::StreamTypeRewriter<StreamType, TOperator>
+				::extend(operation, stream);
 		}
 	}
 
 	template <class TOperator, class... Args>
-	auto operator| (StreamBase<Args...>&& stream, TOperator operation)
-		-> shortening::ExtendingReturnType<TOperator, Args...>
+	constexpr decltype(auto) operator| (StreamBase<Args...>&& stream, TOperator operation)
 	{
 		using StreamType = StreamBase<Args...>;
 
 		if constexpr (std::is_base_of_v<operators::TerminatedOperator, TOperator>) {
-			stream.template assertOnInfinite<StreamType>();
+			if constexpr (!std::is_base_of_v<operators::ShortCircuitOperator, TOperator>)
+				stream.template assertOnInfinite<StreamType>();
 			// INFO: needn't to move the stream because it is terminated operation
 			//       and method 'apply' get the l-value stream.
 			return shortening::TerminatedOperatorTypeApply_t<StreamType, TOperator>
 				(operation).apply(stream);
 		}
 		else {
-			return shortening::StreamTypeExtender_t<StreamType, TOperator>
-				(operation, std::move(stream));
+			return shortening::StreamTypeRewriter<StreamType, TOperator>
+				::extend(operation, std::move(stream));
 		}
 	}
 
 	//-------------------Paired Stream---------------------//
 
-	template <class ...ArgsFirst, class ...ArgsSecond>
-	auto operator&(StreamBase<ArgsFirst...>& first, StreamBase<ArgsSecond...>& second)
-		-> shortening::StreamTypeExtender_t<StreamBase<ArgsFirst...>,
-		operators::paired< StreamBase<ArgsSecond...> > >
+	namespace shortening {
+
+		template <class T>
+		struct IsStream : std::false_type {};
+
+		template <class... Args>
+		struct IsStream<StreamBase<Args...> > : std::true_type {};
+
+		template <class T>
+		constexpr bool IsStream_v = IsStream<std::remove_cv_t<std::remove_reference_t<T> > >::value;
+
+	}
+
+	// Info: streams can be temporary (they are moved then)
+	template <class TFirstStream, class TSecondStream,
+		class = std::enable_if_t<shortening::IsStream_v<TFirstStream> && shortening::IsStream_v<TSecondStream> > >
+	auto operator&(TFirstStream&& first, TSecondStream&& second)
+		-> shortening::StreamTypeExtender_t<std::decay_t<TFirstStream>,
+		operators::paired< std::decay_t<TSecondStream> > >
 	{
-		return (first | operators::paired< StreamBase<ArgsSecond...> >(second));
+		return (std::forward<TFirstStream>(first)
+			| operators::paired< std::decay_t<TSecondStream> >(std::forward<TSecondStream>(second)));
 	}
 
 	template <class ...ArgsFirst, class ...ArgsSecond>
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "tools.h"
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Elements are pulled only until the answer is known,
+		//		so these operators can be applied to infinite streams.
+		//	2) any_of of empty stream is false, all_of and none_of of empty stream are true.
+
+		//-------------------------------------------------------------------------------------//
+		//-----------------------------------Terminated operation-----------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class Predicate>
+		struct any_of : FunctorHolder<Predicate>, TerminatedOperator, ShortCircuitOperator
+		{
+		public:
+			template <class T>
+			using RetType = bool;
+
+		public:
+			constexpr any_of(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+
+			template <class Stream_>
+			constexpr bool apply(Stream_ & obj) {
+				auto predicate = FunctorHolder<Predicate>::functor();
+				while (obj.hasNext())
+					if (predicate(obj.nextElem()))
+						return true;
+				return false;
+			}
+		};
+
+		template <class Predicate>
+		struct all_of : FunctorHolder<Predicate>, TerminatedOperator, ShortCircuitOperator
+		{
+		public:
+			template <class T>
+			using RetType = bool;
+
+		public:
+			constexpr all_of(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+
+			template <class Stream_>
+			constexpr bool apply(Stream_ & obj) {
+				auto predicate = FunctorHolder<Predicate>::functor();
+				while (obj.hasNext())
+					if (!predicate(obj.nextElem()))
+						return false;
+				return true;
+			}
+		};
+
+		template <class Predicate>
+		struct none_of : FunctorHolder<Predicate>, TerminatedOperator, ShortCircuitOperator
+		{
+		public:
+			template <class T>
+			using RetType = bool;
+
+		public:
+			constexpr none_of(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+
+			template <class Stream_>
+			constexpr bool apply(Stream_ & obj) {
+				return !any_of<Predicate>(FunctorHolder<Predicate>::functor()).apply(obj);
+			}
+		};
+
+	}
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "tools.h"
+
+#include <random>
+#include <cmath>
+#include <stdexcept>
+#include <limits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Every element passes with probability p independently from others.
+		//	2) Random generator isn't called per element: the gap between passed elements
+		//		has geometric distribution so it is drawn once and skipped by incrementSlider
+		//		(skipped elements are not materialized).
+		//	3) Result is deterministic under the given seed.
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		struct bernoulli : TReturnSameType
+		{
+		public:
+			using size_type = size_t;
+			using GeneratorType = std::mt19937_64;
+
+		public:
+			bernoulli(double probability, GeneratorType::result_type seed = GeneratorType::default_seed)
+				: probability_(probability), generator_(seed)
+			{
+				if (!(probability > 0. && probability <= 1.))
+					throw std::logic_error("Parameter of bernoulli must be in range (0, 1]");
+			}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+				skipGap(stream);
+				isGapSkipped_ = false;
+				return stream.nextElem();
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				skipGap(stream);
+				isGapSkipped_ = false;
+				stream.incrementSlider();
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				skipGap(stream);
+				return stream.hasNext();
+			}
+
+			double probability() const { return probability_; }
+
+		private:
+			template <class TSubStream>
+			void skipGap(TSubStream& stream) {
+				if (!isGapSkipped_) {
+					for (size_type gap = nextGap(); gap > 0 && stream.hasNext(); gap--)
+						stream.incrementSlider();
+					isGapSkipped_ = true;
+				}
+			}
+
+			// count of failures before the first success
+			size_type nextGap() {
+				if (probability_ >= 1.)
+					return 0;
+				// uniform in (0, 1]
+				const double uniform = double((generator_() >> 11) + 1) * 0x1.0p-53;
+				const double gap = std::floor(std::log(uniform) / std::log1p(-probability_));
+				return (gap < double(std::numeric_limits<size_type>::max()))
+					? size_type(gap) : std::numeric_limits<size_type>::max();
+			}
+
+		private:
+			double probability_;
+			GeneratorType generator_;
+			bool isGapSkipped_ = false;
+		};
+
+	}
+
+}
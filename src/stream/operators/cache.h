@@ -0,0 +1,143 @@
+#pragma once
+
+#include "tools.h"
+
+#include <deque>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::shared_ptr;
+
+		// Contract rules :
+		//	1) cache() takes the whole stream before it and gives a new source stream
+		//		which reads elements from buffer. Elements are pulled from the sub-stream
+		//		(and saved into buffer) the first time they are requested.
+		//	2) Copies of cached stream share the sub-stream and the buffer but each of them
+		//		has its own position. Copy (including copy made by extending, e.g. cached | map(f))
+		//		goes on from the position of the copied stream and replays the elements
+		//		that are buffered already without recomputation of sub-stream.
+		//		Terminated operator applied to l-value cached stream works on its copy, so the stream
+		//		keeps its position and can be reused by other terminals (nextElem() still advances it).
+		//		It holds for cached stream extended by stateless operators only
+		//		(map, cast_to, cast_static, cast_dynamic, with_resource). Other operators (e.g. filter, skip)
+		//		have the state of pulling, so l-value stream with them is consumed by terminal as usual.
+		//	3) Skipped elements are saved too (because other copies can request them).
+		//	4) Buffer is chunked (std::deque), so it isn't relocated when it grows.
+		//	5) Cached stream is infinite if the sub-stream is infinite.
+		//	6) Buffer is allocated by memory resource of the sub-stream if it is set (see with_resource.h).
+		//		Cached stream is a new source, so operators after cache() don't see the resource.
+
+		template <class TStream>
+		class CachedIterator {
+		public:
+			using value_type = typename TStream::ResultValueType;
+			using reference = value_type & ;
+			using const_reference = value_type const &;
+			using pointer = value_type * ;
+			using const_pointer = value_type const *;
+			using iterator_category = std::input_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using size_type = size_t;
+			// Info: polymorphic allocator if the sub-stream has memory resource (see with_resource.h)
+			using allocator_type = AllocatorFor<TStream, value_type>;
+
+		private:
+			struct Buffer {
+				Buffer(TStream stream, allocator_type const & allocator)
+					: stream_(std::move(stream)), elems_(allocator)
+				{}
+
+				// Info: returns false if there is no element with such index
+				bool fetch(size_type index) {
+					while (elems_.size() <= index) {
+						if (!stream_.hasNext())
+							return false;
+						elems_.push_back(stream_.nextElem());
+					}
+					return true;
+				}
+
+				TStream stream_;
+				std::deque<value_type, allocator_type> elems_;
+			};
+			using BufferPtr = shared_ptr<Buffer>;
+
+		public:
+			// end iterator
+			CachedIterator() : pBuffer_(nullptr), index_(0) {}
+			explicit CachedIterator(TStream stream)
+				: pBuffer_(makeBuffer(std::move(stream))), index_(0)
+			{}
+
+			const_reference operator*() const {
+				pBuffer_->fetch(index_);
+				return pBuffer_->elems_[index_];
+			}
+			const_pointer operator->() const { return &(**this); }
+
+			bool operator== (CachedIterator const & other) const {
+				if (pBuffer_ != nullptr && other.pBuffer_ != nullptr)
+					return pBuffer_ == other.pBuffer_ && index_ == other.index_;
+				return isEnd() == other.isEnd();
+			}
+			bool operator!= (CachedIterator const & other) const { return !((*this) == other); }
+
+			CachedIterator& operator++() {
+				++index_;
+				return *this;
+			}
+			CachedIterator operator++(int) {
+				CachedIterator prev = *this;
+				++index_;
+				return prev;
+			}
+
+			//------------Own API------------//
+
+			static constexpr bool isInfinite() { return TStream::isInfinite(); }
+			static constexpr bool isReplayable() { return true; }
+
+			size_type cachedSize() const { return (pBuffer_ == nullptr) ? 0 : pBuffer_->elems_.size(); }
+
+		private:
+			static BufferPtr makeBuffer(TStream stream) {
+				auto allocator = makeAllocator<allocator_type>(stream);
+				return std::allocate_shared<Buffer>(allocator, std::move(stream), allocator);
+			}
+
+			bool isEnd() const { return pBuffer_ == nullptr || !pBuffer_->fetch(index_); }
+
+		private:
+			BufferPtr pBuffer_;
+			size_type index_;
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		// Info: the operator is never stored into stream (see StreamTypeRewriter below)
+		struct cache : TReturnSameType
+		{};
+
+	}
+
+	using operators::cache;
+	using operators::CachedIterator;
+
+	template <class TStream>
+	struct shortening::StreamTypeRewriter<TStream, cache> {
+		using type = StreamBase<CachedIterator<TStream> >;
+
+		template <class TOperator_, class TStream_>
+		static type extend(TOperator_&&, TStream_&& stream) {
+			return type(CachedIterator<TStream>(std::forward<TStream_>(stream)), CachedIterator<TStream>());
+		}
+	};
+
+}
@@ -7,7 +7,7 @@ namespace lipaboy_lib::stream_space {
 	namespace operators {
 
 		template <class TypeCastTo>
-		class cast_to 
+		class cast_to : public StatelessOperator
 		{
 		public:
 			template <class T>
@@ -22,9 +22,9 @@ namespace lipaboy_lib::stream_space {
 			}
 
 			template <class StreamType>
-			void incrementElem(StreamType& stream)
+			void incrementSlider(StreamType& stream)
 			{
-				stream.incrementElem();
+				stream.incrementSlider();
 			}
 
 			template <class StreamType>
@@ -35,7 +35,7 @@ namespace lipaboy_lib::stream_space {
 		};
 
 		template <class TypeCastTo>
-		class cast_static {
+		class cast_static : public StatelessOperator {
 		public:
 			template <class T>
 			using RetType = TypeCastTo; // return the same type
@@ -49,9 +49,9 @@ namespace lipaboy_lib::stream_space {
 			}
 
 			template <class StreamType>
-			void incrementElem(StreamType& stream)
+			void incrementSlider(StreamType& stream)
 			{
-				stream.incrementElem();
+				stream.incrementSlider();
 			}
 
 			template <class StreamType>
@@ -62,7 +62,7 @@ namespace lipaboy_lib::stream_space {
 		};
 
 		template <class TypeCastTo>
-		class cast_dynamic {
+		class cast_dynamic : public StatelessOperator {
 		public:
 			template <class T>
 			using RetType = TypeCastTo; // return the same type
@@ -76,9 +76,9 @@ namespace lipaboy_lib::stream_space {
 			}
 
 			template <class StreamType>
-			void incrementElem(StreamType& stream)
+			void incrementSlider(StreamType& stream)
 			{
-				stream.incrementElem();
+				stream.incrementSlider();
 			}
 
 			template <class StreamType>
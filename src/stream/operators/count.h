@@ -0,0 +1,51 @@
+#pragma once
+
+#include "tools.h"
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		struct count : TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = size_type;
+
+		public:
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				size_type result = 0;
+				if constexpr (Stream_::isRandomAccess()) {
+					result = obj.restSize();
+					obj.advanceSlider(result);
+				}
+				else {
+					// Info: elements are not materialized
+					for (; obj.hasNext(); result++)
+						obj.incrementSlider();
+				}
+				return result;
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = size_type;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return 0; }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & result, Elem_&&) const { result++; }
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & result) const { return result; }
+		};
+
+	}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "tools.h"
+#include "containers/hyper_log_log.h"
+
+#include <functional>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	// Contract rules :
+	//	1) Result is HyperLogLog sketch, call estimate() or count() to get the cardinality.
+	//		Sketches of different streams (chunks, shards) with the same precision can be merged
+	//		or serialized and merged later.
+	//	2) Memory is bounded by 2^precision bytes unlike distinct that keeps all the unique elements.
+	//	3) Elements are hashed by std::hash.
+
+	//------------------------------------------------------------------------------------------------//
+	//-----------------------------------Terminated operation-----------------------------------------//
+	//------------------------------------------------------------------------------------------------//
+
+	namespace operators {
+
+		struct count_distinct_approx : TerminatedOperator
+		{
+		public:
+			template <class T>
+			using RetType = HyperLogLog;
+
+		public:
+			count_distinct_approx(unsigned int precision = 14) : precision_(precision) {}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				return applyByAccumulating<Stream_>(*this, obj);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = HyperLogLog;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return HyperLogLog(precision_); }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & sketch, Elem_&& elem) const {
+				using ValueType = std::remove_cv_t<std::remove_reference_t<Elem_> >;
+				sketch.add(elem, std::hash<ValueType>());
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & sketch) const { return std::move(sketch); }
+
+			unsigned int precision() const { return precision_; }
+
+		private:
+			unsigned int precision_;
+		};
+
+	}
+
+}
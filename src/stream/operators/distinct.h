@@ -6,6 +6,7 @@
 #include <memory>
 #include <unordered_set>
 #include <functional>
+#include <memory_resource>
 
 namespace lipaboy_lib::stream_space {
 
@@ -23,37 +24,53 @@ namespace lipaboy_lib::stream_space {
 		struct distinct : TReturnSameType
 		{};
 
-		template <class T>
-		struct distinct_impl : public filter_impl<std::function<bool(T&)>, T>
+		// Info: TContainer is std::pmr::unordered_set if stream has memory resource (see with_resource.h).
+		//		 That's why the set is created at the first request of element
+		//		 (together with its holder, by the resource).
+		template <class T, class TContainer = std::unordered_set<T,
+			std::hash<std::remove_const_t<T> >, std::equal_to<T> > >
+		struct distinct_impl;
+
+		template <class TContainer>
+		struct InsertionPredicate {
+			// set is owned by distinct_impl
+			TContainer* pSet = nullptr;
+
+			template <class Elem_>
+			bool operator()(Elem_ & elem) const { return pSet->insert(elem).second; }
+		};
+
+		template <class T, class TContainer>
+		struct distinct_impl : public filter_impl<InsertionPredicate<TContainer>, T>
 		{
 			using type = T;
+			using Predicate = InsertionPredicate<TContainer>;
+			using Base = filter_impl<Predicate, T>;
 			//using reference = std::reference_wrapper<type>;
-            using ContainerType = std::unordered_set<
-                //reference,
-                type,
-                std::hash<std::remove_const_t<type> >,
-                std::equal_to<type> >;
+            using ContainerType = TContainer;
 			using ContainerTypePtr = shared_ptr<ContainerType>;
 
 		public:
             distinct_impl(distinct)
-				// init by stopper, not more
-                : filter_impl<std::function<bool(T&)>, T>(std::function<bool(T&)>([](T&) { return true; }))
-			{
-				pDistinctSet_ = std::make_shared<ContainerType>();
-				ContainerTypePtr tempSet = pDistinctSet_;
-#ifdef DEBUG_STREAM_WITH_NOISY
-				std::cout << "\tset is created" << endl;
-#endif
-				// set by real functor of filtering
-				this->setFunctor(std::function<bool(T&)>(
-					[set = tempSet](T & elem) -> bool 
-					{
-                        bool isInserted = set->insert(elem).second;
-                        if (isInserted)
-							return true;
-						return false;
-					}));
+				: Base(filter<Predicate>(Predicate()))
+			{}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+				init(stream);
+				return Base::nextElem(stream);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				init(stream);
+				Base::incrementSlider(stream);
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				init(stream);
+				return Base::hasNext(stream);
 			}
 
 #ifdef DEBUG_STREAM_WITH_NOISY
@@ -63,7 +80,24 @@ namespace lipaboy_lib::stream_space {
 #endif
 
 		private:
-			ContainerTypePtr pDistinctSet_;
+			template <class TSubStream>
+			void init(TSubStream& stream) {
+				if (pDistinctSet_ != nullptr)
+					return;
+				// Info: polymorphic allocator passes the resource into the set
+				if constexpr (IsPolymorphicAllocated<ContainerType>::value)
+					pDistinctSet_ = std::allocate_shared<ContainerType>(
+						std::pmr::polymorphic_allocator<ContainerType>(stream.memoryResource()));
+				else
+					pDistinctSet_ = std::make_shared<ContainerType>();
+#ifdef DEBUG_STREAM_WITH_NOISY
+				std::cout << "\tset is created" << endl;
+#endif
+				this->setFunctor(Predicate{ pDistinctSet_.get() });
+			}
+
+		private:
+			ContainerTypePtr pDistinctSet_ = nullptr;
 		};
 
 	}
@@ -77,7 +111,9 @@ namespace lipaboy_lib::stream_space {
 		using remref = std::remove_reference_t<T>;
 
 		using type = typename remref<TStream>::template ExtendedStreamType<
-			remref<distinct_impl<typename TStream::ResultValueType> > >;
+			remref<distinct_impl<typename TStream::ResultValueType,
+				operators::ContainerFor<TStream, typename distinct_impl<typename TStream::ResultValueType>::ContainerType>
+			> > >;
 	};
 
 }
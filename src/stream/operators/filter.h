@@ -3,6 +3,8 @@
 #include "tools.h"
 
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 namespace lipaboy_lib::stream_space {
 
@@ -22,74 +24,161 @@ namespace lipaboy_lib::stream_space {
 		//--------------------------------Unterminated operation------------------------------//
 		//-------------------------------------------------------------------------------------//
 
+		// Info: storage of current element of filter. Trivial elements are kept inline
+		//		 (without allocation, and filter is usable in constant expressions then),
+		//		 others are kept by pointer.
+		//		 Pointer is allocated by memory resource of stream if it is set (see with_resource.h).
+		//		 Allocation is reused after reset() while the holder owns it alone. Copies of stream
+		//		 share it until one of them sets a new element.
+		template <class T, bool isInline = std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> >
+		class CurrentElemHolder {
+		public:
+			bool empty() const { return !hasElem_; }
+			T & operator*() { return *pElem_; }
+
+			template <class Elem_>
+			void set(Elem_&& elem) {
+				if (pElem_ != nullptr && pElem_.use_count() == 1)
+					*pElem_ = std::forward<Elem_>(elem);
+				else if (pResource_ != nullptr)
+					pElem_ = std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(pResource_),
+						std::forward<Elem_>(elem));
+				else
+					pElem_ = std::make_shared<T>(std::forward<Elem_>(elem));
+				hasElem_ = true;
+			}
+			void reset() { hasElem_ = false; }
+
+			// Info: moves the element out if the holder owns it alone, copies it otherwise
+			//		 (another copy of stream still has to give it)
+			T take() {
+				hasElem_ = false;
+				if constexpr (std::is_copy_constructible_v<T>)
+					if (pElem_.use_count() > 1)
+						return *pElem_;
+				return std::move(*pElem_);
+			}
+
+			template <class TSubStream>
+			void bind(TSubStream& stream) {
+				if constexpr (TSubStream::hasMemoryResource())
+					pResource_ = stream.memoryResource();
+			}
+
+		private:
+			shared_ptr<T> pElem_ = nullptr;
+			std::pmr::memory_resource* pResource_ = nullptr;
+			bool hasElem_ = false;
+		};
+
+		template <class T>
+		class CurrentElemHolder<T, true> {
+		public:
+			constexpr bool empty() const { return !hasElem_; }
+			constexpr T & operator*() { return elem_; }
+
+			template <class Elem_>
+			constexpr void set(Elem_&& elem) {
+				elem_ = std::forward<Elem_>(elem);
+				hasElem_ = true;
+			}
+			constexpr void reset() { hasElem_ = false; }
+
+			constexpr T take() {
+				hasElem_ = false;
+				return elem_;
+			}
+
+			template <class TSubStream>
+			constexpr void bind(TSubStream&) {}
+
+		private:
+			T elem_ = T();
+			bool hasElem_ = false;
+		};
+
 		template <class Predicate>
 		struct filter : FunctorHolder<Predicate>, TReturnSameType
 		{
 		public:
-			filter(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+			constexpr filter(Predicate functor) : FunctorHolder<Predicate>(functor) {}
 		};
 
 		template <class Predicate, class T>
 		struct filter_impl : FunctorHolder<Predicate>, TReturnSameType
 		{
 		public:
-			filter_impl(filter<Predicate> obj) 
+			template <class, class> friend struct filter_impl;
+
+		public:
+			constexpr filter_impl(filter<Predicate> obj) 
 				: FunctorHolder<Predicate>(obj.functor()) 
 			{}
+			// Info: it is used by fusion of adjacent filters (stream/operators/fusion.h).
+			//		 Takes the current element of other filter but not its saved result
+			//		 because the predicate is changed.
+			template <class OtherPredicate>
+			constexpr filter_impl(filter_impl<OtherPredicate, T> const & other, Predicate functor)
+				: FunctorHolder<Predicate>(functor),
+				currentElem_(other.currentElem_)
+			{}
 
 			// Opinion: difficult construction but without extra executions and computions
 
 			template <class TSubStream>
-			auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+			constexpr auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
 				// Info: I think you mustn't think about corrupting of branch predicator
 				//		 because the gist of filtering is checking the conditions
 
 				// ! calling hasNext() of current StreamType ! in order to skip unfilter elems
 				hasNext(stream);
 				resetSaves();
-				auto temp = std::move(*pCurrentElem_);
+				auto temp = currentElem_.take();
 				if (stream.hasNext()) {
-					*pCurrentElem_ = stream.nextElem();
+					currentElem_.set(stream.nextElem());
 					hasNext(stream);
 				}
 				else
-					pCurrentElem_ = nullptr;
+					currentElem_.reset();
 				return temp;
 			}
 
 			template <class TSubStream>
-			void incrementSlider(TSubStream& stream) { 
+			constexpr void incrementSlider(TSubStream& stream) { 
 				hasNext(stream);
+				resetSaves();
 				if (stream.hasNext()) {
-					*pCurrentElem_ = std::move(stream.nextElem());
-					resetSaves();
+					currentElem_.set(stream.nextElem());
 					hasNext(stream);
 				}
+				else
+					currentElem_.reset();
 			}
 
 			template <class TSubStream>
-			bool hasNext(TSubStream& stream) {
+			constexpr bool hasNext(TSubStream& stream) {
 				if (isSavesActual_)
 					return curr_;
 
-				if (pCurrentElem_ == nullptr) {
+				if (currentElem_.empty()) {
+					currentElem_.bind(stream);
 					if (!stream.hasNext()) {
 						saveResult(false);
 						return false;
 					}
-					pCurrentElem_ = std::make_shared<T>(std::move(stream.nextElem()));
+					currentElem_.set(stream.nextElem());
 					resetSaves();
 				}
 
 				bool isHasNext = false;
 				do {
-					// Info: We don't have the right to std::move the content of pCurrentElem_
-					if (FunctorHolder<Predicate>::functor()(*pCurrentElem_)) {
+					// Info: We don't have the right to std::move the content of current element
+					if (FunctorHolder<Predicate>::functor()(*currentElem_)) {
 						saveResult(true);
 						return true;
 					}
 					if (isHasNext = stream.hasNext()) {
-						*pCurrentElem_ = std::move(stream.nextElem());
+						currentElem_.set(stream.nextElem());
 						resetSaves();
 					}
 				} while (isHasNext);
@@ -99,16 +188,16 @@ namespace lipaboy_lib::stream_space {
 			}
 
 		private:
-			void saveResult(bool result) {
+			constexpr void saveResult(bool result) {
 				isSavesActual_ = true;
 				curr_ = result;
 			}
-			void resetSaves() {
+			constexpr void resetSaves() {
 				isSavesActual_ = false;
 			}
 
 		private:
-			shared_ptr<T> pCurrentElem_ = nullptr;
+			CurrentElemHolder<T> currentElem_;
 			bool curr_ = false;
 			bool isSavesActual_ = false;
 		};
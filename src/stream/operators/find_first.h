@@ -0,0 +1,40 @@
+#pragma once
+
+#include "tools.h"
+
+#include <optional>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Returns the first element which satisfies the predicate (or nullopt).
+		//		Elements after it are not pulled, so it can be applied to infinite streams.
+
+		template <class Predicate>
+		struct find_first : FunctorHolder<Predicate>, TerminatedOperator, ShortCircuitOperator
+		{
+		public:
+			template <class T>
+			using RetType = std::optional<T>;
+
+		public:
+			constexpr find_first(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+
+			template <class Stream_>
+			constexpr auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				auto predicate = FunctorHolder<Predicate>::functor();
+				while (obj.hasNext()) {
+					auto elem = obj.nextElem();
+					if (predicate(elem))
+						return elem;
+				}
+				return std::nullopt;
+			}
+		};
+
+	}
+
+}
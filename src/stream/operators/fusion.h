@@ -0,0 +1,215 @@
+#pragma once
+
+#include "tools.h"
+#include "map.h"
+#include "filter.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace lipaboy_lib::stream_space {
+
+	// INFO: compile-time fusion of adjacent operators. Every operator extends the stream
+	//		 by one more level of StreamBase, so the long chains of map/filter give the deep
+	//		 instantiations and the deep chain of calls. Rewrite rules:
+	//
+	//		 1) map(f)    | map(g)    -> map(g . f)
+	//		 2) filter(p) | filter(q) -> filter(p && q)
+	//		 3) map(f)    | filter(p) -> map_filter(f, p)   - transforms and tests in one stage
+	//		 4) map_filter(f, p) | filter(q) -> map_filter(f, p && q)
+	//
+	//		 Fusion assumes that functors are pure (like the whole stream does).
+
+	namespace operators {
+
+		//----------------------Fused functors----------------------//
+
+		template <class First, class Second>
+		struct ComposedFunctor {
+		public:
+			constexpr ComposedFunctor(First first, Second second)
+				: first_(std::move(first)), second_(std::move(second))
+			{}
+
+			template <class Arg>
+			constexpr auto operator()(Arg&& arg)
+				-> std::invoke_result_t<Second&, std::invoke_result_t<First&, Arg&&> >
+			{
+				return second_(first_(std::forward<Arg>(arg)));
+			}
+
+		private:
+			First first_;
+			Second second_;
+		};
+
+		template <class First, class Second>
+		struct ConjunctionFunctor {
+		public:
+			constexpr ConjunctionFunctor(First first, Second second)
+				: first_(std::move(first)), second_(std::move(second))
+			{}
+
+			// Info: the second predicate is tested only if the first one is passed
+			//		 (the same as for two filters in a row).
+			template <class Arg>
+			constexpr bool operator()(Arg& arg) {
+				return first_(arg) && second_(arg);
+			}
+
+		private:
+			First first_;
+			Second second_;
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		namespace detail {
+
+			// Info: presents the sub-stream as a stream of transformed elements
+			//		 in order to reuse filter_impl without copy-pasting it.
+			template <class TSubStream, class Transform>
+			struct TransformedStreamRef {
+				using ResultValueType = std::invoke_result_t<Transform&, typename TSubStream::ResultValueType>;
+
+				constexpr ResultValueType nextElem() { return transform_(stream_.nextElem()); }
+				constexpr bool hasNext() { return stream_.hasNext(); }
+				constexpr void incrementSlider() { stream_.incrementSlider(); }
+
+				static constexpr bool hasMemoryResource() { return TSubStream::hasMemoryResource(); }
+				auto memoryResource() const { return stream_.memoryResource(); }
+
+				TSubStream& stream_;
+				Transform& transform_;
+			};
+
+		}
+
+		template <class Transform, class Predicate, class T>
+		struct map_filter_impl : filter_impl<Predicate, T>
+		{
+			using Base = filter_impl<Predicate, T>;
+
+			template <class, class, class> friend struct map_filter_impl;
+
+		public:
+			template <class Arg>
+			using RetType = T;
+
+		public:
+			constexpr map_filter_impl(Transform transform, Predicate predicate)
+				: Base(filter<Predicate>(predicate)),
+				transform_(std::move(transform))
+			{}
+			template <class OtherPredicate>
+			constexpr map_filter_impl(map_filter_impl<Transform, OtherPredicate, T> const & other, Predicate predicate)
+				: Base(static_cast<filter_impl<OtherPredicate, T> const &>(other), predicate),
+				transform_(other.transform_)
+			{}
+
+			template <class TSubStream>
+			constexpr auto nextElem(TSubStream& stream) -> T {
+				auto transformed = transformedStream(stream);
+				return Base::nextElem(transformed);
+			}
+
+			template <class TSubStream>
+			constexpr void incrementSlider(TSubStream& stream) {
+				auto transformed = transformedStream(stream);
+				Base::incrementSlider(transformed);
+			}
+
+			template <class TSubStream>
+			constexpr bool hasNext(TSubStream& stream) {
+				auto transformed = transformedStream(stream);
+				return Base::hasNext(transformed);
+			}
+
+		private:
+			template <class TSubStream>
+			constexpr auto transformedStream(TSubStream& stream) -> detail::TransformedStreamRef<TSubStream, Transform> {
+				return detail::TransformedStreamRef<TSubStream, Transform>{ stream, transform_ };
+			}
+
+		private:
+			Transform transform_;
+		};
+
+	}
+
+	using operators::ComposedFunctor;
+	using operators::ConjunctionFunctor;
+	using operators::map_filter_impl;
+
+	namespace shortening {
+
+		template <class Functor>
+		using HeldFunctorType = typename operators::FunctorHolder<Functor>::FunctorType;
+
+		//----------------------Rewrite rules----------------------//
+
+		// 1) map | map
+		template <class First, class... Rest, class Second>
+		struct StreamTypeRewriter<StreamBase<operators::map<First>, Rest...>, operators::map<Second> > {
+			using SubType = StreamBase<Rest...>;
+			using FunctorType = ComposedFunctor<HeldFunctorType<First>, HeldFunctorType<Second> >;
+			using OperatorType = operators::map<FunctorType>;
+			using type = StreamBase<OperatorType, Rest...>;
+
+			template <class TOperator_, class TStream_>
+			static constexpr type extend(TOperator_&& operation, TStream_&& stream) {
+				return type(OperatorType(FunctorType(stream.operation().functor(), operation.functor())),
+					RelativeForward<TStream_&&, SubType>::forward(stream));
+			}
+		};
+
+		// 2) filter | filter
+		template <class First, class T, class... Rest, class Second>
+		struct StreamTypeRewriter<StreamBase<operators::filter_impl<First, T>, Rest...>, operators::filter<Second> > {
+			using SubType = StreamBase<Rest...>;
+			using FunctorType = ConjunctionFunctor<HeldFunctorType<First>, HeldFunctorType<Second> >;
+			using OperatorType = operators::filter_impl<FunctorType, T>;
+			using type = StreamBase<OperatorType, Rest...>;
+
+			template <class TOperator_, class TStream_>
+			static constexpr type extend(TOperator_&& operation, TStream_&& stream) {
+				return type(OperatorType(stream.operation(), FunctorType(stream.operation().functor(), operation.functor())),
+					RelativeForward<TStream_&&, SubType>::forward(stream));
+			}
+		};
+
+		// 3) map | filter
+		template <class Transform, class... Rest, class Predicate>
+		struct StreamTypeRewriter<StreamBase<operators::map<Transform>, Rest...>, operators::filter<Predicate> > {
+			using SubType = StreamBase<Rest...>;
+			using OperatorType = map_filter_impl<HeldFunctorType<Transform>, HeldFunctorType<Predicate>,
+				typename StreamBase<operators::map<Transform>, Rest...>::ResultValueType>;
+			using type = StreamBase<OperatorType, Rest...>;
+
+			template <class TOperator_, class TStream_>
+			static constexpr type extend(TOperator_&& operation, TStream_&& stream) {
+				return type(OperatorType(stream.operation().functor(), operation.functor()),
+					RelativeForward<TStream_&&, SubType>::forward(stream));
+			}
+		};
+
+		// 4) map_filter | filter
+		template <class Transform, class First, class T, class... Rest, class Second>
+		struct StreamTypeRewriter<StreamBase<map_filter_impl<Transform, First, T>, Rest...>, operators::filter<Second> > {
+			using SubType = StreamBase<Rest...>;
+			using FunctorType = ConjunctionFunctor<First, HeldFunctorType<Second> >;
+			using OperatorType = map_filter_impl<Transform, FunctorType, T>;
+			using type = StreamBase<OperatorType, Rest...>;
+
+			template <class TOperator_, class TStream_>
+			static constexpr type extend(TOperator_&& operation, TStream_&& stream) {
+				return type(OperatorType(stream.operation(), FunctorType(stream.operation().functor(), operation.functor())),
+					RelativeForward<TStream_&&, SubType>::forward(stream));
+			}
+		};
+
+	}
+
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "tools.h"
+#include "extra_tools/span.h"
+
+#include <vector>
+#include <type_traits>
+#include <stdexcept>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::vector;
+
+		// Contract rules :
+		//	1) In View mode the returned span points to the inner buffer of operator.
+		//		It is valid only until the next call of nextElem() or incrementSlider().
+		//		Don't store the spans (e.g. by to_vector()) - copy their content instead.
+		//	2) In MoveOut mode the buffer is moved out to client and allocated again
+		//		with exact capacity (one allocation per group instead of growing the vector).
+		//	3) Buffer is allocated by memory resource of stream if it is set (see with_resource.h),
+		//		in MoveOut mode groups are std::pmr::vector then.
+		//	4) View mode isn't available for bool elements: buffer std::vector<bool> is packed by bits,
+		//		so there is no array of bool to point to. MoveOut mode gives std::vector<bool> groups.
+
+		enum class GroupOwnership {
+			View,
+			MoveOut
+		};
+
+		template <GroupOwnership ownership = GroupOwnership::View>
+		struct group_by_span {
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = lipaboy_lib::enable_if_else_t<ownership == GroupOwnership::View,
+				lipaboy_lib::span<const T>, vector<T> >;
+
+		public:
+			group_by_span(size_type partSize) : partSize_(partSize) {
+				if (partSize == 0)
+					throw std::logic_error("Parameter of group_by_span constructor must be positive");
+			}
+
+			size_type part() const { return partSize_; }
+
+		private:
+			size_type partSize_;
+		};
+
+		template <class T, GroupOwnership ownership = GroupOwnership::View, class TBuffer = vector<T> >
+		struct group_by_span_impl {
+		public:
+			using size_type = size_t;
+			using BufferType = TBuffer;
+
+			template <class Arg_>
+			using RetType = lipaboy_lib::enable_if_else_t<ownership == GroupOwnership::View,
+				lipaboy_lib::span<const Arg_>, BufferType>;
+			using ReturnType = RetType<T>;
+
+			static_assert(ownership != GroupOwnership::View || !std::is_same_v<T, bool>,
+				"Stream.GroupBySpan error: View mode can't give span of bool elements "
+				"(std::vector<bool> has no data()), use GroupOwnership::MoveOut or map elements to char");
+
+		public:
+			group_by_span_impl(size_type partSize) : partSize_(partSize) {
+				if (partSize == 0)
+					throw std::logic_error("Parameter of group_by_span constructor must be positive");
+			}
+			// Info: it is not copy-constructor
+			group_by_span_impl(group_by_span<ownership> const & groupObj)
+				: group_by_span_impl(groupObj.part())
+			{}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream)
+				-> ReturnType
+			{
+				// Info: buffer is reserved here (not in constructor) because operator
+				//		 is copied several times while the stream is being extended.
+				auto & buffer = buffer_.get(stream);
+				buffer.clear();
+				if (buffer.capacity() < partSize())
+					buffer.reserve(partSize());
+
+				for (size_type i = 0; i < partSize() && stream.hasNext(); i++)
+					buffer.push_back(stream.nextElem());
+
+				if constexpr (ownership == GroupOwnership::View)
+					return ReturnType(buffer.data(), buffer.size());
+				else
+					return std::move(buffer);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				for (size_type i = 0; i < partSize() && stream.hasNext(); i++)
+					stream.incrementSlider();
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				return stream.hasNext();
+			}
+
+			size_type partSize() const { return partSize_; }
+
+		private:
+			size_type partSize_;
+			LazyContainer<BufferType> buffer_;
+		};
+
+	}
+
+	using operators::GroupOwnership;
+	using operators::group_by_span;
+	using operators::group_by_span_impl;
+
+	template <class TStream, GroupOwnership ownership>
+	struct shortening::StreamTypeExtender<TStream, group_by_span<ownership> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			remref<group_by_span_impl<typename TStream::ResultValueType, ownership,
+				operators::ContainerFor<TStream, std::vector<typename TStream::ResultValueType> > > > >;
+	};
+
+}
@@ -32,13 +32,14 @@ namespace lipaboy_lib::stream_space {
 			size_type partSize_;
 		};
 
-		template <class T>
+		// Info: TContainer is std::pmr::vector if stream has memory resource (see with_resource.h)
+		template <class T, class TContainer = vector<T> >
 		struct group_by_vector_impl {
 		public:
 			using size_type = size_t;
 
 			template <class Arg_>
-			using RetType = vector<Arg_>;
+			using RetType = TContainer;
 			using ReturnType = RetType<T>;
 			using const_reference = const ReturnType &;
 
@@ -56,7 +57,7 @@ namespace lipaboy_lib::stream_space {
 			auto nextElem(TSubStream& stream)
 				-> ReturnType
 			{
-				ReturnType part;
+				ReturnType part = makeContainer<ReturnType>(stream);
 
 				for (size_type i = 0; i < partSize() && stream.hasNext(); i++)
 					part.push_back(std::move(stream.nextElem()));
@@ -92,7 +93,8 @@ namespace lipaboy_lib::stream_space {
 		using remref = std::remove_reference_t<T>;
 
 		using type = typename remref<TStream>::template ExtendedStreamType<
-			remref<group_by_vector_impl<typename TStream::ResultValueType> > >;
+			remref<group_by_vector_impl<typename TStream::ResultValueType,
+				operators::ContainerFor<TStream, std::vector<typename TStream::ResultValueType> > > > >;
 	};
 
 }
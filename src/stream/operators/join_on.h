@@ -0,0 +1,266 @@
+#pragma once
+
+#include "tools.h"
+
+#include <unordered_map>
+#include <optional>
+#include <utility>
+#include <tuple>
+#include <functional>
+#include <type_traits>
+#include <iterator>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Hash join: the other stream is the build side - it is fully read into hash table
+		//		(at the first request of element), the main stream is the probe side and flows lazily.
+		//		So pass the smaller stream as the other one.
+		//	2) join_on gives pair (left, right) for every pair of elements with equal keys
+		//		(inner join), left_join_on gives additionally pair (left, nullopt) for every
+		//		left element without matches (left outer join).
+		//	3) Order of pairs follows the main stream; order of matches of one left element is unspecified.
+		//	4) Keys are compared by std::equal_to and hashed by std::hash.
+		//	5) Memory of build side is reported by buildSideMemory() of the stream's operation
+		//		(stream.operation().buildSideMemory()). It is estimation (nodes and buckets of table)
+		//		without dynamic memory owned by elements.
+		//	6) Stream can be copied in the middle of iteration: the copy owns its own hash table
+		//		and goes on from the same match as the original one.
+		//	7) Hash table is allocated by memory resource of the main stream if it is set (see with_resource.h).
+
+		enum class JoinType {
+			Inner,
+			LeftOuter
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <JoinType joinType, class TOtherStream, class LeftKey, class RightKey>
+		struct join_operator
+		{
+		public:
+			using OtherStreamType = TOtherStream;
+			using RightType = typename TOtherStream::ResultValueType;
+			using MatchType = std::conditional_t<joinType == JoinType::Inner,
+				RightType, std::optional<RightType> >;
+
+			template <class T>
+			using RetType = std::pair<T, MatchType>;
+
+		public:
+			join_operator(TOtherStream other, LeftKey leftKey, RightKey rightKey)
+				: other_(std::move(other)), leftKey_(leftKey), rightKey_(rightKey)
+			{}
+
+			TOtherStream const & other() const { return other_; }
+			LeftKey leftKey() const { return leftKey_; }
+			RightKey rightKey() const { return rightKey_; }
+
+		private:
+			TOtherStream other_;
+			LeftKey leftKey_;
+			RightKey rightKey_;
+		};
+
+		template <class TOtherStream, class LeftKey, class RightKey>
+		struct join_on : join_operator<JoinType::Inner, TOtherStream, LeftKey, RightKey>
+		{
+			join_on(TOtherStream other, LeftKey leftKey, RightKey rightKey)
+				: join_operator<JoinType::Inner, TOtherStream, LeftKey, RightKey>(
+					std::move(other), leftKey, rightKey)
+			{}
+		};
+
+		template <class TOtherStream, class LeftKey, class RightKey>
+		struct left_join_on : join_operator<JoinType::LeftOuter, TOtherStream, LeftKey, RightKey>
+		{
+			left_join_on(TOtherStream other, LeftKey leftKey, RightKey rightKey)
+				: join_operator<JoinType::LeftOuter, TOtherStream, LeftKey, RightKey>(
+					std::move(other), leftKey, rightKey)
+			{}
+		};
+
+		// Info: Allocator is polymorphic one if stream has memory resource (see with_resource.h)
+		template <JoinType joinType, class TOtherStream, class LeftKey, class RightKey, class T,
+			class Allocator = std::allocator<T> >
+		struct join_on_impl
+		{
+		public:
+			using OperatorType = join_operator<joinType, TOtherStream, LeftKey, RightKey>;
+			using RightType = typename OperatorType::RightType;
+			using MatchType = typename OperatorType::MatchType;
+			using ResultValueType = typename OperatorType::template RetType<T>;
+			using KeyType = std::remove_cv_t<std::remove_reference_t<
+				std::invoke_result_t<RightKey, RightType const &> > >;
+			using TableType = std::unordered_multimap<KeyType, RightType, std::hash<KeyType>, std::equal_to<KeyType>,
+				RebindAllocator<Allocator, std::pair<const KeyType, RightType> > >;
+			using TableIterator = typename TableType::const_iterator;
+			using size_type = size_t;
+
+			template <class>
+			using RetType = ResultValueType;
+
+		public:
+			join_on_impl(OperatorType const & obj)
+				: other_(obj.other()), leftKey_(obj.leftKey()), rightKey_(obj.rightKey())
+			{}
+			// Info: iterators of matches point into table of copied object,
+			//		 so they are found again in the own table.
+			join_on_impl(join_on_impl const & obj) : join_on_impl(obj, obj.consumedMatches()) {}
+			join_on_impl(join_on_impl && obj) : join_on_impl(std::move(obj), obj.consumedMatches()) {}
+
+			join_on_impl& operator=(join_on_impl const &) = delete;
+			join_on_impl& operator=(join_on_impl &&) = delete;
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> ResultValueType {
+				hasNext(stream);
+				if constexpr (joinType == JoinType::LeftOuter) {
+					if (isUnmatched_) {
+						isUnmatched_ = false;
+						return takeCurrent(std::nullopt);
+					}
+				}
+				auto right = match_++;
+				// the last match can take the left element
+				if (match_ == matchEnd_)
+					return takeCurrent(right->second);
+				return ResultValueType(*current_, right->second);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				hasNext(stream);
+				if (match_ != matchEnd_)
+					++match_;
+				else
+					isUnmatched_ = false;
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				build(stream);
+				while (!(current_.has_value() && (match_ != matchEnd_ || isUnmatched_))) {
+					if (!stream.hasNext())
+						return false;
+					current_ = stream.nextElem();
+					std::tie(match_, matchEnd_) = table_->equal_range(std::invoke(leftKey_, *current_));
+					isUnmatched_ = (joinType == JoinType::LeftOuter && match_ == matchEnd_);
+				}
+				return true;
+			}
+
+			// count of elements of build side
+			size_type buildSideSize() const { return table_.isCreated() ? table_->size() : 0; }
+			// estimated memory of hash table of build side in bytes
+			size_type buildSideMemory() const {
+				// node: value, pointer to next node and cached hash
+				constexpr size_type NODE_SIZE = sizeof(typename TableType::value_type)
+					+ sizeof(void*) + sizeof(size_t);
+				if (!table_.isCreated())
+					return 0;
+				return table_->size() * NODE_SIZE + table_->bucket_count() * sizeof(void*);
+			}
+
+		private:
+			template <class Impl_>
+			join_on_impl(Impl_&& obj, size_type consumed)
+				: other_(std::forward<Impl_>(obj).other_),
+				leftKey_(obj.leftKey_),
+				rightKey_(obj.rightKey_),
+				table_(std::forward<Impl_>(obj).table_),
+				isBuilt_(obj.isBuilt_),
+				current_(std::forward<Impl_>(obj).current_),
+				isUnmatched_(obj.isUnmatched_)
+			{
+				restoreMatches(consumed);
+			}
+
+			// count of matches of current element that are already given
+			size_type consumedMatches() const {
+				if (!isBuilt_ || !current_.has_value())
+					return 0;
+				return size_type(std::distance(
+					table_->equal_range(std::invoke(leftKey_, *current_)).first, match_));
+			}
+
+			void restoreMatches(size_type consumed) {
+				if (!isBuilt_)
+					return;
+				if (current_.has_value()) {
+					std::tie(match_, matchEnd_) = table_->equal_range(std::invoke(leftKey_, *current_));
+					std::advance(match_, consumed);
+				}
+				else
+					match_ = matchEnd_ = table_->cend();
+			}
+
+			template <class TSubStream>
+			void build(TSubStream& stream) {
+				if (isBuilt_)
+					return;
+				auto & table = table_.get(stream);
+				while (other_.hasNext()) {
+					RightType right = other_.nextElem();
+					KeyType key = std::invoke(rightKey_, std::as_const(right));
+					table.emplace(std::move(key), std::move(right));
+				}
+				match_ = matchEnd_ = table.cend();
+				isBuilt_ = true;
+			}
+
+			template <class Match_>
+			ResultValueType takeCurrent(Match_&& match) {
+				ResultValueType result(std::move(*current_), std::forward<Match_>(match));
+				current_.reset();
+				return result;
+			}
+
+		private:
+			TOtherStream other_;
+			LeftKey leftKey_;
+			RightKey rightKey_;
+
+			LazyContainer<TableType> table_;
+			bool isBuilt_ = false;
+
+			std::optional<T> current_;
+			TableIterator match_;
+			TableIterator matchEnd_;
+			bool isUnmatched_ = false;
+		};
+
+	}
+
+	using operators::JoinType;
+	using operators::join_on;
+	using operators::left_join_on;
+	using operators::join_on_impl;
+
+	template <class TStream, class TOtherStream, class LeftKey, class RightKey>
+	struct shortening::StreamTypeExtender<TStream, join_on<TOtherStream, LeftKey, RightKey> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			join_on_impl<JoinType::Inner, TOtherStream, LeftKey, RightKey,
+				typename remref<TStream>::ResultValueType,
+				operators::AllocatorFor<TStream, typename remref<TStream>::ResultValueType> > >;
+	};
+
+	template <class TStream, class TOtherStream, class LeftKey, class RightKey>
+	struct shortening::StreamTypeExtender<TStream, left_join_on<TOtherStream, LeftKey, RightKey> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			join_on_impl<JoinType::LeftOuter, TOtherStream, LeftKey, RightKey,
+				typename remref<TStream>::ResultValueType,
+				operators::AllocatorFor<TStream, typename remref<TStream>::ResultValueType> > >;
+	};
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "tools.h"
+
+#include <tuple>
+#include <utility>
+
+namespace lipaboy_lib::stream_space {
+
+	// Contract rules :
+	//	1) Every terminated operator that is passed into multi must implement Accumulate API
+	//		(initAccumulator, accumulate, finish) - see "stream/operators/operators.h".
+	//	2) Element is passed into every accumulator as l-value, so the accumulators copy it
+	//		if they need to store it (the stream is single-pass and element is shared).
+
+	//------------------------------------------------------------------------------------------------//
+	//-----------------------------------Terminated operation-----------------------------------------//
+	//------------------------------------------------------------------------------------------------//
+
+	namespace operators {
+
+		template <class... TOperators>
+		struct multi : TerminatedOperator
+		{
+		public:
+			using OperatorsType = std::tuple<TOperators...>;
+
+		public:
+			multi(TOperators... operations) : operators_(std::move(operations)...) {}
+
+			OperatorsType const & operators() const { return operators_; }
+
+		private:
+			OperatorsType operators_;
+		};
+
+		template <class... TImpls>
+		struct multi_impl : TerminatedOperator
+		{
+		public:
+			using ImplsType = std::tuple<TImpls...>;
+			using IndicesType = std::index_sequence_for<TImpls...>;
+
+			template <class T>
+			using RetType = std::tuple<typename TImpls::template RetType<T>...>;
+
+		public:
+			template <class... TOperators>
+			multi_impl(multi<TOperators...> const & obj)
+				: impls_(std::make_from_tuple<ImplsType>(obj.operators()))
+			{}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				return applyByAccumulating<Stream_>(*this, obj);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = std::tuple<typename TImpls::template AccumulatorType<T>...>;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				return initAccumulator<T>(IndicesType());
+			}
+			template <class T, class Stream_>
+			AccumulatorType<T> initAccumulator(Stream_ & stream) const {
+				return initAccumulator<T>(stream, IndicesType());
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulators, Elem_&& elem) const {
+				accumulate<T>(accumulators, elem, IndicesType());
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & accumulators) const {
+				return finish<T>(accumulators, IndicesType());
+			}
+
+		private:
+			template <class T, size_t... I>
+			AccumulatorType<T> initAccumulator(std::index_sequence<I...>) const {
+				return AccumulatorType<T>(std::get<I>(impls_).template initAccumulator<T>()...);
+			}
+			template <class T, class Stream_, size_t... I>
+			AccumulatorType<T> initAccumulator(Stream_ & stream, std::index_sequence<I...>) const {
+				return AccumulatorType<T>(initAccumulatorFor<T>(std::get<I>(impls_), stream)...);
+			}
+
+			template <class T, class Elem_, size_t... I>
+			void accumulate(AccumulatorType<T> & accumulators, Elem_& elem, std::index_sequence<I...>) const {
+				(std::get<I>(impls_).template accumulate<T>(std::get<I>(accumulators), elem), ...);
+			}
+
+			template <class T, size_t... I>
+			RetType<T> finish(AccumulatorType<T> & accumulators, std::index_sequence<I...>) const {
+				return RetType<T>(std::get<I>(impls_).template finish<T>(std::get<I>(accumulators))...);
+			}
+
+		private:
+			ImplsType impls_;
+		};
+
+	}
+
+	using operators::multi;
+	using operators::multi_impl;
+
+	template <class TStream, class... TOperators>
+	struct shortening::TerminatedOperatorTypeApply<TStream, multi<TOperators...> > {
+		using type = multi_impl<TerminatedOperatorTypeApply_t<TStream, TOperators>...>;
+	};
+
+}
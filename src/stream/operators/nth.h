@@ -8,7 +8,7 @@ namespace lipaboy_lib::stream_space {
 
 	namespace operators {
 
-		struct nth : TerminatedOperator
+		struct nth : TerminatedOperator, ShortCircuitOperator
 		{
 		public:
 			using size_type = size_t;
@@ -22,8 +22,11 @@ namespace lipaboy_lib::stream_space {
 			template <class Stream_>
 			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
 			{
-				for (size_t i = 0; i < count() && obj.hasNext(); i++)
-					obj.incrementSlider();
+				if constexpr (Stream_::isRandomAccess())
+					obj.advanceSlider(count());
+				else
+					for (size_t i = 0; i < count() && obj.hasNext(); i++)
+						obj.incrementSlider();
 				if (!obj.hasNext())
 					return std::nullopt;
 				return std::move(obj.nextElem());
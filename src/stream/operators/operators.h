@@ -4,15 +4,28 @@
 
 // non-terminated operations
 #include "filter.h"
+#include "take_while.h"
 #include "group_by_vector.h"
+#include "group_by_span.h"
 #include "get.h"
 #include "skip.h"
 #include "ungroup_by_bit.h"
 #include "map.h"
+#include "parallel_map.h"
 #include "distinct.h"
 #include "split.h"
 #include "cast.h"
 #include "to_pair.h"
+#include "zip.h"
+#include "bernoulli.h"
+#include "join_on.h"
+#include "with_resource.h"
+#include "cache.h"
+#include "reverse.h"
+#include "sorted_radix.h"
+#include "unique_adjacent.h"
+#include "run_length.h"
+#include "fusion.h"
 
 //	   terminated operations
 #include "nth.h"
@@ -20,7 +33,16 @@
 #include "reduce.h"
 #include "sum.h"
 #include "to_vector.h"
+#include "to_array.h"
 #include "max.h"
+#include "count.h"
+#include "multi.h"
+#include "stats.h"
+#include "count_distinct_approx.h"
+#include "sample.h"
+#include "any_of.h"
+#include "find_first.h"
+#include "partition_to.h"
 
 namespace lipaboy_lib::stream_space {
 
@@ -81,6 +103,23 @@ namespace lipaboy_lib::stream_space {
 	//		template <class StreamType>
 	//		auto apply(StreamType & stream) -> SomeReturnType;
 	//
+	// 5) Terminated operator can also implement Accumulate API (it's necessary for 'multi' operator
+	//		which feeds several terminated operators by one pass):
+	//
+	//		template <class T>
+	//		using AccumulatorType = YourAccumulatorType<T>;
+	//
+	//		template <class T>
+	//		AccumulatorType<T> initAccumulator() const;
+	//
+	//		template <class T, class Elem_>
+	//		void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const;
+	//
+	//		template <class T>
+	//		RetType<T> finish(AccumulatorType<T> & accumulator) const;
+	//
+	//		Then 'apply' can be written as: return applyByAccumulating<StreamType>(*this, stream);
+	//
 	// Your instruments (par. 3 and 4):
 	//	- stream.hasNext();
 	//	- stream.nextElem();
@@ -115,9 +154,9 @@ namespace lipaboy_lib::stream_space {
 			}
 
 			template <class StreamType>
-			void incrementElem(StreamType & stream)
+			void incrementSlider(StreamType & stream)
 			{
-				stream.incrementElem();
+				stream.incrementSlider();
 			}
 
 			template <class StreamType>
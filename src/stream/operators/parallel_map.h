@@ -0,0 +1,291 @@
+#pragma once
+
+#include "tools.h"
+
+#include <vector>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::shared_ptr;
+
+		// Contract rules :
+		//	1) Transform is applied to elements by pool of threads but results go out in input order.
+		//		Downstream operators see usual single-threaded stream.
+		//	2) Transform is copied into every worker and called concurrently, so it must be thread-safe.
+		//	3) At most 'window' elements are in flight (dispatched but not emitted yet). Elements are
+		//		pulled from sub-stream ahead by the thread that consumes the stream.
+		//		Results wait for emission in the reorder buffer (ring of 'window' slots).
+		//	4) Exception thrown by transform is rethrown when its element is emitted.
+		//	5) Results are stored, so the element type is decayed (no references).
+		//	6) Workers are started at the first request of element and stopped by destructor.
+		//		Copy of started stream gets its own workers: results that are in flight in the original
+		//		are awaited and copied into the copy, so both streams go on from the same element independently.
+		//	7) Shared state, task queue and reorder buffer are allocated by memory resource of stream if it is set
+		//		(see with_resource.h). Memory resources aren't thread-safe, so all of them are allocated
+		//		by the consuming thread at start and workers never allocate by the resource.
+		//		Internal allocations of std::thread aren't covered.
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class Transform>
+		struct parallel_map : FunctorHolder<Transform>
+		{
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = std::decay_t<std::invoke_result_t<Transform, T> >;
+
+		public:
+			parallel_map(Transform functor, size_type threads = defaultThreads(), size_type window = 0)
+				: FunctorHolder<Transform>(functor),
+				threads_(threads),
+				window_((window > 0) ? window : 4 * threads)
+			{
+				if (threads == 0)
+					throw std::logic_error("Parameter of parallel_map (threads) must be positive");
+			}
+
+			size_type threads() const { return threads_; }
+			size_type window() const { return window_; }
+
+			static size_type defaultThreads() {
+				return std::max<size_type>(1, std::thread::hardware_concurrency());
+			}
+
+		private:
+			size_type threads_;
+			size_type window_;
+		};
+
+		// Info: Allocator is polymorphic one if stream has memory resource (see with_resource.h)
+		template <class Transform, class T, class Allocator = std::allocator<T> >
+		struct parallel_map_impl : FunctorHolder<Transform>
+		{
+		public:
+			using size_type = size_t;
+			using ResultType = typename parallel_map<Transform>::template RetType<T>;
+
+			template <class>
+			using RetType = ResultType;
+
+		private:
+			struct Slot {
+				std::optional<ResultType> result;
+				std::exception_ptr error;
+				bool isReady = false;
+			};
+
+			using SlotAllocator = RebindAllocator<Allocator, Slot>;
+
+			struct SharedState {
+				SharedState(size_type window, Allocator const & allocator)
+					: tasks(window, RebindAllocator<Allocator, std::optional<T> >(allocator)),
+					slots(window, SlotAllocator(allocator))
+				{}
+
+				std::mutex mutex;
+				std::condition_variable taskAdded;
+				std::condition_variable slotReady;
+				// ring of elements that wait for workers (task with sequence number i is in cell i % window)
+				std::vector<std::optional<T>, RebindAllocator<Allocator, std::optional<T> > > tasks;
+				size_type queued = 0;
+				size_type taken = 0;
+				std::vector<Slot, SlotAllocator> slots;
+				bool isStopped = false;
+			};
+			using SharedStatePtr = shared_ptr<SharedState>;
+
+			class WorkerPool {
+			public:
+				WorkerPool(SharedStatePtr state, size_type threads, FunctorHolder<Transform> const & holder,
+					Allocator const & allocator)
+					: state_(state),
+					workers_(RebindAllocator<Allocator, std::thread>(allocator))
+				{
+					workers_.reserve(threads);
+					for (size_type i = 0; i < threads; i++)
+						workers_.emplace_back(&WorkerPool::work, state, holder.functor());
+				}
+				~WorkerPool() {
+					{
+						std::lock_guard<std::mutex> lock(state_->mutex);
+						state_->isStopped = true;
+					}
+					state_->taskAdded.notify_all();
+					for (auto & worker : workers_)
+						worker.join();
+				}
+
+			private:
+				static void work(SharedStatePtr state, typename FunctorHolder<Transform>::FunctorType functor) {
+					while (true) {
+						std::unique_lock<std::mutex> lock(state->mutex);
+						state->taskAdded.wait(lock, [&state]() { return state->isStopped || state->taken < state->queued; });
+						if (state->isStopped)
+							return;
+						const size_type sequence = state->taken++;
+						auto & cell = state->tasks[sequence % state->tasks.size()];
+						T elem = std::move(*cell);
+						cell.reset();
+						lock.unlock();
+
+						Slot slot;
+						try {
+							slot.result.emplace(functor(std::move(elem)));
+						}
+						catch (...) {
+							slot.error = std::current_exception();
+						}
+						slot.isReady = true;
+
+						lock.lock();
+						state->slots[sequence % state->slots.size()] = std::move(slot);
+						lock.unlock();
+						state->slotReady.notify_all();
+					}
+				}
+
+			private:
+				SharedStatePtr state_;
+				std::vector<std::thread, RebindAllocator<Allocator, std::thread> > workers_;
+			};
+
+		public:
+			parallel_map_impl(parallel_map<Transform> const & obj)
+				: FunctorHolder<Transform>(obj.functor()),
+				threads_(obj.threads()),
+				window_(obj.window())
+			{}
+			parallel_map_impl(parallel_map_impl const & obj)
+				: FunctorHolder<Transform>(obj),
+				threads_(obj.threads_),
+				window_(obj.window_),
+				// results of original are copied by its resource
+				pending_((obj.pState_ != nullptr) ? obj.pState_->slots.get_allocator() : obj.pending_.get_allocator())
+			{
+				pending_.reserve(obj.pendingCount() + obj.dispatched_ - obj.emitted_);
+				pending_.insert(pending_.end(), obj.pending_.begin() + obj.pendingTaken_, obj.pending_.end());
+				if (obj.pState_ == nullptr)
+					return;
+				std::unique_lock<std::mutex> lock(obj.pState_->mutex);
+				for (size_type i = obj.emitted_; i < obj.dispatched_; i++) {
+					auto const & slot = obj.pState_->slots[i % window()];
+					obj.pState_->slotReady.wait(lock, [&slot]() { return slot.isReady; });
+					pending_.push_back(slot);
+				}
+			}
+			parallel_map_impl(parallel_map_impl &&) = default;
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> ResultType {
+				dispatch(stream);
+				auto slot = take();
+				// keep workers busy while the element is processed by downstream
+				dispatch(stream);
+				if (slot.error)
+					std::rethrow_exception(slot.error);
+				return std::move(*slot.result);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				// Info: element that isn't dispatched yet is skipped without transforming
+				if (pendingCount() == 0 && emitted_ == dispatched_)
+					stream.incrementSlider();
+				else
+					take();
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				dispatch(stream);
+				return pendingCount() > 0 || emitted_ < dispatched_;
+			}
+
+			size_type threads() const { return threads_; }
+			size_type window() const { return window_; }
+
+		private:
+			template <class TSubStream>
+			void dispatch(TSubStream& stream) {
+				while (pendingCount() + dispatched_ - emitted_ < window() && stream.hasNext()) {
+					start(stream);
+					T elem = stream.nextElem();
+					{
+						std::lock_guard<std::mutex> lock(pState_->mutex);
+						// Info: cell is free because element that was in it before is emitted already
+						pState_->tasks[dispatched_++ % window()].emplace(std::move(elem));
+						pState_->queued++;
+					}
+					pState_->taskAdded.notify_one();
+				}
+			}
+
+			Slot take() {
+				if (pendingCount() > 0)
+					return std::move(pending_[pendingTaken_++]);
+				std::unique_lock<std::mutex> lock(pState_->mutex);
+				auto & slot = pState_->slots[emitted_ % window()];
+				pState_->slotReady.wait(lock, [&slot]() { return slot.isReady; });
+				Slot result = std::move(slot);
+				slot = Slot();
+				emitted_++;
+				return result;
+			}
+
+			size_type pendingCount() const { return pending_.size() - pendingTaken_; }
+
+			template <class TSubStream>
+			void start(TSubStream& stream) {
+				if (pPool_ != nullptr)
+					return;
+				auto allocator = makeAllocator<Allocator>(stream);
+				pState_ = std::allocate_shared<SharedState>(allocator, window(), allocator);
+				pPool_ = std::allocate_shared<WorkerPool>(allocator, pState_, threads(), *this, allocator);
+			}
+
+		private:
+			size_type threads_;
+			size_type window_;
+
+			// count of elements that are given to workers and that are emitted
+			size_type dispatched_ = 0;
+			size_type emitted_ = 0;
+			// results that were in flight in the copied stream (they go before dispatched ones)
+			std::vector<Slot, SlotAllocator> pending_;
+			size_type pendingTaken_ = 0;
+
+			SharedStatePtr pState_ = nullptr;
+			shared_ptr<WorkerPool> pPool_ = nullptr;
+		};
+
+	}
+
+	using operators::parallel_map;
+	using operators::parallel_map_impl;
+
+	template <class TStream, class Transform>
+	struct shortening::StreamTypeExtender<TStream, parallel_map<Transform> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			parallel_map_impl<Transform, typename remref<TStream>::ResultValueType,
+				operators::AllocatorFor<remref<TStream>, typename remref<TStream>::ResultValueType> > >;
+	};
+
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "tools.h"
+
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::vector;
+
+		// Contract rules :
+		//	1) partition_to(p) splits the stream by one pass into pair of vectors:
+		//		(elements that satisfy p, the rest ones). Order of elements is kept.
+		//	2) partition_to(p, outTrue, outFalse) writes the elements into output iterators
+		//		(like std::partition_copy) and returns the pair of iterators after the last written ones.
+		//	3) Predicate is called once per element with it as l-value, then the element is moved into its part.
+		//	4) If the count of elements (N) is known (source is random access or sizeHint is passed)
+		//		then each vector reserves half of it. Part that outgrows its half reserves
+		//		all the elements that can still go to it (N - size of the other part), so it reallocates
+		//		at most once and both parts hold at most 1.5 * N elements whatever the split is.
+		//		Vector that is filled less than by half is shrunk at the end.
+		//	5) partition_count(p) returns pair of counts: (elements that satisfy p, the rest ones).
+		//	6) If stream has memory resource (see with_resource.h) then the parts are std::pmr::vector's
+		//		allocated by it.
+
+		//-------------------------------------------------------------------------------------//
+		//-----------------------------------Terminated operation-----------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		// Info: TVector is the type of parts if it is set (pmr vector if stream has memory resource)
+		template <class Predicate, class OutTrue = FalseType, class OutFalse = FalseType, class TVector = FalseType>
+		struct partition_to : FunctorHolder<Predicate>, TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			static constexpr bool isToVectors = std::is_same_v<OutTrue, FalseType>;
+
+			template <class T>
+			using VectorType = std::conditional_t<std::is_same_v<TVector, FalseType>, vector<T>, TVector>;
+
+			template <class T>
+			using RetType = std::conditional_t<isToVectors,
+				std::pair<VectorType<T>, VectorType<T> >, std::pair<OutTrue, OutFalse> >;
+
+		public:
+			partition_to(Predicate functor, size_type sizeHint = 0)
+				: FunctorHolder<Predicate>(functor),
+				sizeHint_(sizeHint)
+			{}
+			partition_to(Predicate functor, OutTrue outTrue, OutFalse outFalse)
+				: FunctorHolder<Predicate>(functor),
+				outTrue_(outTrue),
+				outFalse_(outFalse)
+			{}
+			template <class TVector_>
+			partition_to(partition_to<Predicate, FalseType, FalseType, TVector_> const & obj)
+				: FunctorHolder<Predicate>(obj.functor()),
+				sizeHint_(obj.sizeHint())
+			{}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				using T = typename Stream_::ResultValueType;
+
+				auto accumulator = initAccumulatorFor<T>(*this, obj);
+				auto predicate = FunctorHolder<Predicate>::functor();
+				size_type size = sizeHint_;
+				if constexpr (isToVectors) {
+					if constexpr (Stream_::isRandomAccess())
+						size = obj.restSize();
+					accumulator.first.reserve(size / 2 + size % 2);
+					accumulator.second.reserve(size / 2 + size % 2);
+				}
+				while (obj.hasNext())
+					place(predicate, accumulator, obj.nextElem(), size);
+				return finish<T>(accumulator);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = RetType<T>;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				if constexpr (isToVectors)
+					return AccumulatorType<T>();
+				else
+					return AccumulatorType<T>(outTrue_, outFalse_);
+			}
+			// parts are allocated by resource of stream (e.g. when it's fed by 'multi')
+			template <class T, class Stream_>
+			AccumulatorType<T> initAccumulator(Stream_ & stream) const {
+				if constexpr (isToVectors)
+					return AccumulatorType<T>(makeContainer<VectorType<T> >(stream), makeContainer<VectorType<T> >(stream));
+				else
+					return AccumulatorType<T>(outTrue_, outFalse_);
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				place(FunctorHolder<Predicate>::functor(), accumulator, std::forward<Elem_>(elem), 0);
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & accumulator) const {
+				if constexpr (isToVectors) {
+					shrinkUnderfilled(accumulator.first);
+					shrinkUnderfilled(accumulator.second);
+				}
+				return std::move(accumulator);
+			}
+
+			size_type sizeHint() const { return sizeHint_; }
+
+		private:
+			// Info: vector that has grown by itself is filled at least by half
+			template <class Vector_>
+			static void shrinkUnderfilled(Vector_ & part) {
+				if (part.size() < part.capacity() / 2)
+					part.shrink_to_fit();
+			}
+
+			// Info: size is the expected count of all the elements (0 if it's unknown)
+			template <class Predicate_, class Accumulator_, class Elem_>
+			static void place(Predicate_&& predicate, Accumulator_& accumulator, Elem_&& elem, size_type size) {
+				bool isMatched = predicate(elem);
+				if constexpr (isToVectors) {
+					auto & part = isMatched ? accumulator.first : accumulator.second;
+					auto const & other = isMatched ? accumulator.second : accumulator.first;
+					// part outgrows its half: it can't get more than the rest of elements
+					if (part.size() == part.capacity() && part.size() + other.size() < size)
+						part.reserve(size - other.size());
+					part.push_back(std::forward<Elem_>(elem));
+				}
+				else {
+					if (isMatched)
+						*accumulator.first++ = std::forward<Elem_>(elem);
+					else
+						*accumulator.second++ = std::forward<Elem_>(elem);
+				}
+			}
+
+		private:
+			size_type sizeHint_ = 0;
+			OutTrue outTrue_;
+			OutFalse outFalse_;
+		};
+
+		template <class Predicate>
+		partition_to(Predicate) -> partition_to<Predicate>;
+		template <class Predicate>
+		partition_to(Predicate, size_t) -> partition_to<Predicate>;
+		template <class Predicate, class OutTrue, class OutFalse>
+		partition_to(Predicate, OutTrue, OutFalse) -> partition_to<Predicate, OutTrue, OutFalse>;
+
+		template <class Predicate>
+		struct partition_count : FunctorHolder<Predicate>, TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = std::pair<size_type, size_type>;
+
+		public:
+			partition_count(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				auto predicate = FunctorHolder<Predicate>::functor();
+				size_type matched = 0;
+				size_type total = 0;
+				for (; obj.hasNext(); total++)
+					if (predicate(obj.nextElem()))
+						matched++;
+				return { matched, total - matched };
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = RetType<T>;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return { 0, 0 }; }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & counts, Elem_&& elem) const {
+				if (FunctorHolder<Predicate>::functor()(elem))
+					counts.first++;
+				else
+					counts.second++;
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & counts) const { return counts; }
+		};
+
+	}
+
+	using operators::partition_to;
+	using operators::partition_count;
+
+	template <class TStream, class Predicate>
+	struct shortening::TerminatedOperatorTypeApply<TStream, partition_to<Predicate> > {
+		using type = partition_to<Predicate, FalseType, FalseType,
+			operators::ContainerFor<TStream, std::vector<typename TStream::ResultValueType> > >;
+	};
+
+}
@@ -23,11 +23,25 @@ namespace lipaboy_lib::stream_space {
 
 			template <class Stream_>
 			std::ostream& apply(Stream_ & obj) {
-				for (; obj.hasNext(); )
-					ostream() << obj.nextElem() << delimiter();
-				return ostream();
+				return applyByAccumulating<Stream_>(*this, obj);
 			}
 
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = std::ostream*;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return &ostreamObj_; }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & pOstream, Elem_&& elem) const {
+				(*pOstream) << std::forward<Elem_>(elem) << delimiter();
+			}
+
+			template <class T>
+			std::ostream& finish(AccumulatorType<T> & pOstream) const { return *pOstream; }
+
 			std::ostream& ostream() { return ostreamObj_; }
 			string const & delimiter() const { return delimiter_; }
 		private:
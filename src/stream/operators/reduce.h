@@ -38,7 +38,7 @@ namespace lipaboy_lib::stream_space {
 			TerminatedOperator
 		{
 		public:
-			reduce(AccumulatorFn&& accum, IdentityFn&& identity)
+			constexpr reduce(AccumulatorFn&& accum, IdentityFn&& identity)
 				: FunctorHolder<AccumulatorFn>(accum),
 				FunctorHolder<IdentityFn>(identity)
 			{
@@ -47,17 +47,17 @@ namespace lipaboy_lib::stream_space {
 					"Stream.Reduce Error: count arguments of lambda \
 						function is not equal to 2.");
 			}
-			reduce(AccumulatorFn&& accum)
+			constexpr reduce(AccumulatorFn&& accum)
 				: FunctorHolder<AccumulatorFn>(accum),
-				FunctorHolder<IdentityFn>([]() {})
+				FunctorHolder<IdentityFn>(IdentityFn())
 			{
 				static_assert(GetArgumentCount<AccumulatorFn> == 2,
 					"Stream.Reduce Error: count arguments of lambda \
 						function is not equal to 2.");
 			}
 
-			FunctorHolder<AccumulatorFn> accum() { return FunctorHolder<AccumulatorFn>(*this); }
-			FunctorHolder<IdentityFn> identity() { return FunctorHolder<IdentityFn>(*this); }
+			constexpr FunctorHolder<AccumulatorFn> accum() const { return FunctorHolder<AccumulatorFn>(*this); }
+			constexpr FunctorHolder<IdentityFn> identity() const { return FunctorHolder<IdentityFn>(*this); }
 
 		};
 
@@ -80,27 +80,27 @@ namespace lipaboy_lib::stream_space {
 			using RetType = std::optional<AccumRetType>;
 
 		public:
-			reduce_impl(reduce<AccumulatorFn, IdentityFn> reduceObj) 
+			constexpr reduce_impl(reduce<AccumulatorFn, IdentityFn> reduceObj) 
 				: FunctorHolder<AccumulatorFn>(reduceObj.accum().functor()),
 				FunctorHolder<IdentityFn>(reduceObj.identity().functor())
 			{}
-			reduce_impl(AccumulatorFn&& accum, IdentityFn&& identity)
+			constexpr reduce_impl(AccumulatorFn&& accum, IdentityFn&& identity)
 				: FunctorHolder<AccumulatorFn>(accum),
 				FunctorHolder<IdentityFn>(identity)
 			{}
-			reduce_impl(AccumulatorFn&& accum)
+			constexpr reduce_impl(AccumulatorFn&& accum)
 				: FunctorHolder<AccumulatorFn>(accum),
-				FunctorHolder<IdentityFn>([]() {})
+				FunctorHolder<IdentityFn>(IdentityFn())
 			{}
 
 			template <class TResult_, class Arg_>
-			AccumRetType accum(TResult_&& result, Arg_&& arg) const {
+			constexpr AccumRetType accum(TResult_&& result, Arg_&& arg) const {
 				return FunctorHolder<AccumulatorFn>::functor()(std::forward<TResult_>(result),
 					std::forward<Arg_>(arg));
 			}
 
 			template <class Arg_>
-			AccumRetType identity(Arg_&& arg) const {
+			constexpr AccumRetType identity(Arg_&& arg) const {
 				if constexpr (std::is_same_v<IdentityFn, FalseType>)
 					return AccumRetType(std::forward<Arg_>(arg));
 				else
@@ -108,7 +108,7 @@ namespace lipaboy_lib::stream_space {
 			}
 
 			template <class Stream_>
-			auto apply(Stream_ & obj) -> RetType<void>
+			constexpr auto apply(Stream_ & obj) -> RetType<void>
 			{
 				if (!obj.hasNext())
 					return std::nullopt;
@@ -119,6 +119,28 @@ namespace lipaboy_lib::stream_space {
 				return result;
 			}
 
+			//-----------------Accumulate API--------------//
+
+			// Info: 'apply' doesn't use it because the first element is known there
+			//		 and the optional is not checked at every step.
+
+			template <class T>
+			using AccumulatorType = std::optional<AccumRetType>;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return std::nullopt; }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & result, Elem_&& elem) const {
+				if (result.has_value())
+					result = accum(*result, std::forward<Elem_>(elem));
+				else
+					result = identity(std::forward<Elem_>(elem));
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & result) const { return std::move(result); }
+
 		};
 
 	}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "tools.h"
+#include "map.h"
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::vector;
+
+		// Contract rules :
+		//	1) If the stream is a source of bidirectional outside iterators followed only by maps
+		//		then reverse() doesn't buffer anything: the source is walked backwards
+		//		(by std::reverse_iterator) and maps are applied to its elements as before.
+		//	2) Otherwise all the elements are pulled into buffer at the first request.
+		//		Buffer is a list of chunks with growing capacity, so there are no reallocations
+		//		of the whole buffer. Elements are moved out of it and empty chunks are freed.
+		//	3) Infinite stream can't be reversed.
+		//	4) Buffer is allocated by memory resource of stream if it is set (see with_resource.h).
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		struct reverse : TReturnSameType
+		{};
+
+		// Info: Allocator is polymorphic one if stream has memory resource (see with_resource.h)
+		template <class T, class Allocator = std::allocator<T> >
+		struct reverse_impl : TReturnSameType
+		{
+		public:
+			using size_type = size_t;
+			using ChunkType = vector<T, Allocator>;
+			using BufferType = vector<ChunkType, RebindAllocator<Allocator, ChunkType> >;
+
+			static constexpr size_type FIRST_CHUNK_SIZE = 64;
+			static constexpr size_type MAX_CHUNK_SIZE = 1 << 16;
+
+		public:
+			reverse_impl(reverse) {}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> T {
+				fill(stream);
+				T elem = std::move(chunks_->back().back());
+				pop();
+				return elem;
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				fill(stream);
+				pop();
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				fill(stream);
+				return !chunks_->empty();
+			}
+
+		private:
+			template <class TSubStream>
+			void fill(TSubStream& stream) {
+				if (isFilled_)
+					return;
+				isFilled_ = true;
+				auto & chunks = chunks_.get(stream);
+				size_type chunkSize = FIRST_CHUNK_SIZE;
+				while (stream.hasNext()) {
+					if (chunks.empty() || chunks.back().size() == chunkSize) {
+						if (!chunks.empty())
+							chunkSize = std::min(2 * chunkSize, MAX_CHUNK_SIZE);
+						// Info: chunk takes allocator of the buffer (uses-allocator construction)
+						chunks.emplace_back(ChunkType(chunks.get_allocator()));
+						chunks.back().reserve(chunkSize);
+					}
+					chunks.back().push_back(stream.nextElem());
+				}
+			}
+
+			void pop() {
+				chunks_->back().pop_back();
+				if (chunks_->back().empty())
+					chunks_->pop_back();
+			}
+
+		private:
+			LazyContainer<BufferType> chunks_;
+			bool isFilled_ = false;
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//----------------------------Reversing without buffering-----------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class TStream>
+		struct IsReversibleStream : std::false_type {};
+
+		template <class TIterator>
+		struct IsReversibleStream<StreamBase<TIterator> >
+			: std::bool_constant<std::is_base_of_v<std::bidirectional_iterator_tag,
+				typename std::iterator_traits<TIterator>::iterator_category> >
+		{};
+
+		template <class Transform, class First, class... Rest>
+		struct IsReversibleStream<StreamBase<map<Transform>, First, Rest...> >
+			: IsReversibleStream<StreamBase<First, Rest...> >
+		{};
+
+		template <class TStream>
+		struct ReversedStream;
+
+		template <class TIterator>
+		struct ReversedStream<StreamBase<TIterator> > {
+			using type = StreamBase<std::reverse_iterator<TIterator> >;
+
+			static type make(StreamBase<TIterator> const & stream) {
+				return type(std::make_reverse_iterator(stream.sourceEnd()),
+					std::make_reverse_iterator(stream.sourceBegin()));
+			}
+		};
+
+		template <class Transform, class First, class... Rest>
+		struct ReversedStream<StreamBase<map<Transform>, First, Rest...> > {
+			using SubType = StreamBase<First, Rest...>;
+			using type = typename ReversedStream<SubType>::type::template ExtendedStreamType<map<Transform> >;
+
+			static type make(StreamBase<map<Transform>, First, Rest...> const & stream) {
+				return type(stream.operation(),
+					ReversedStream<SubType>::make(static_cast<SubType const &>(stream)));
+			}
+		};
+
+		template <class TStream>
+		struct BufferedReversedStream {
+			using ImplType = reverse_impl<typename TStream::ResultValueType,
+				AllocatorFor<TStream, typename TStream::ResultValueType> >;
+			using type = typename TStream::template ExtendedStreamType<ImplType>;
+		};
+
+	}
+
+	using operators::reverse;
+	using operators::reverse_impl;
+
+	template <class TStream>
+	struct shortening::StreamTypeRewriter<TStream, reverse> {
+		static_assert(!TStream::isInfinite(), "Stream error: attempt to reverse infinite stream");
+
+		static constexpr bool isReversible = operators::IsReversibleStream<TStream>::value;
+
+		using type = typename std::conditional_t<isReversible,
+			operators::ReversedStream<TStream>, operators::BufferedReversedStream<TStream> >::type;
+
+		template <class TOperator_, class TStream_>
+		static type extend(TOperator_&& operation, TStream_&& stream) {
+			if constexpr (isReversible)
+				return operators::ReversedStream<TStream>::make(stream);
+			else
+				return type(typename operators::BufferedReversedStream<TStream>::ImplType(operation),
+					std::forward<TStream_>(stream));
+		}
+	};
+
+}
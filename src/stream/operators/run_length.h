@@ -0,0 +1,76 @@
+#pragma once
+
+#include "tools.h"
+#include "unique_adjacent.h"
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) run_length(eq) replaces every run of equal adjacent elements by pair
+		//		(first element of run, length of run).
+		//	2) Elements are compared with the first element of run and only the next run's
+		//		first element is stored (see contract rules of unique_adjacent).
+		//	3) Sorted stream gives the count of every distinct element (by one pass without hash map).
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class Equal = std::equal_to<> >
+		struct run_length : FunctorHolder<Equal>
+		{
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = std::pair<T, size_type>;
+
+		public:
+			run_length(Equal eq = Equal()) : FunctorHolder<Equal>(eq) {}
+		};
+
+		template <class Equal, class T>
+		struct run_length_impl : AdjacentRunsHolder<Equal, T>
+		{
+		public:
+			using Base = AdjacentRunsHolder<Equal, T>;
+			using ResultType = typename run_length<Equal>::template RetType<T>;
+
+			template <class>
+			using RetType = ResultType;
+
+		public:
+			run_length_impl(run_length<Equal> const & obj) : Base(obj.functor()) {}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> ResultType {
+				return Base::takeRun(stream);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				Base::takeRun(stream);
+			}
+		};
+
+	}
+
+	using operators::run_length;
+	using operators::run_length_impl;
+
+	template <class TStream, class Equal>
+	struct shortening::StreamTypeExtender<TStream, run_length<Equal> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			run_length_impl<Equal, typename remref<TStream>::ResultValueType> >;
+	};
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "tools.h"
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace lipaboy_lib::stream_space {
+
+	// Contract rules :
+	//	1) Result is uniform sample of k elements (without replacement) in the order of reservoir.
+	//		If stream has less than k elements then all of them are returned.
+	//	2) Reservoir sampling by Algorithm L (Li, "Reservoir-Sampling Algorithms of Time Complexity
+	//		O(n(1 + log(N/n)))"): count of elements to skip is drawn from geometric distribution,
+	//		so random generator is called O(k * log(N / k)) times, not per element.
+	//		Skipped elements are not materialized (incrementSlider).
+	//	3) Result is deterministic under the given seed.
+	//	4) Reservoir is allocated by memory resource of stream if it is set (see with_resource.h),
+	//		result is std::pmr::vector then.
+
+	//------------------------------------------------------------------------------------------------//
+	//-----------------------------------Terminated operation-----------------------------------------//
+	//------------------------------------------------------------------------------------------------//
+
+	namespace operators {
+
+		struct sample : TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+			using GeneratorType = std::mt19937_64;
+
+			template <class T>
+			using RetType = std::vector<T>;
+
+		public:
+			sample(size_type count, GeneratorType::result_type seed = GeneratorType::default_seed)
+				: count_(count), seed_(seed)
+			{
+				if (count == 0)
+					throw std::logic_error("Parameter of sample must be positive");
+			}
+
+			size_type count() const { return count_; }
+			GeneratorType::result_type seed() const { return seed_; }
+
+		private:
+			size_type count_;
+			GeneratorType::result_type seed_;
+		};
+
+		// Info: TVector is std::pmr::vector if stream has memory resource (see with_resource.h)
+		template <class TVector>
+		struct sample_impl : TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+			using GeneratorType = sample::GeneratorType;
+
+			template <class T>
+			using RetType = TVector;
+
+		public:
+			sample_impl(sample const & obj) : count_(obj.count()), seed_(obj.seed()) {}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				using T = typename Stream_::ResultValueType;
+				auto accumulator = initAccumulator<T>(obj);
+				auto & reservoir = accumulator.reservoir;
+
+				while (reservoir.size() < count() && obj.hasNext())
+					reservoir.push_back(obj.nextElem());
+				if (reservoir.size() < count())
+					return std::move(reservoir);
+
+				while (true) {
+					for (; accumulator.gap > 0 && obj.hasNext(); accumulator.gap--)
+						obj.incrementSlider();
+					if (!obj.hasNext())
+						break;
+					replace(accumulator, obj.nextElem());
+				}
+				return std::move(reservoir);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			struct AccumulatorType {
+				TVector reservoir;
+				GeneratorType generator;
+				double logWeight = 0.;
+				size_type gap = 0;
+			};
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				return initAccumulator<T>(TVector());
+			}
+			// reservoir is allocated by resource of stream
+			template <class T, class Stream_>
+			AccumulatorType<T> initAccumulator(Stream_ & stream) const {
+				return initAccumulator<T>(makeContainer<TVector>(stream));
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				if (accumulator.reservoir.size() < count())
+					accumulator.reservoir.push_back(std::forward<Elem_>(elem));
+				else if (accumulator.gap > 0)
+					accumulator.gap--;
+				else
+					replace(accumulator, std::forward<Elem_>(elem));
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & accumulator) const {
+				return std::move(accumulator.reservoir);
+			}
+
+			size_type count() const { return count_; }
+
+		private:
+			template <class T>
+			AccumulatorType<T> initAccumulator(TVector reservoir) const {
+				AccumulatorType<T> accumulator{ std::move(reservoir), GeneratorType(seed_) };
+				accumulator.reservoir.reserve(count());
+				nextWeight(accumulator);
+				return accumulator;
+			}
+
+			template <class T, class Elem_>
+			void replace(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				const size_type index = size_type(uniform(accumulator.generator) * double(count()));
+				accumulator.reservoir[std::min(index, count() - 1)] = std::forward<Elem_>(elem);
+				nextWeight(accumulator);
+			}
+
+			// Info: weight W is kept in logarithm to avoid underflow for huge streams
+			template <class T>
+			void nextWeight(AccumulatorType<T> & accumulator) const {
+				accumulator.logWeight += std::log(uniform(accumulator.generator)) / double(count());
+				// log(1 - W)
+				const double logRest = std::log1p(-std::exp(accumulator.logWeight));
+				const double gap = std::floor(std::log(uniform(accumulator.generator)) / logRest);
+				accumulator.gap = (gap < double(std::numeric_limits<size_type>::max()))
+					? size_type(gap) : std::numeric_limits<size_type>::max();
+			}
+
+			// uniform in (0, 1]
+			static double uniform(GeneratorType & generator) {
+				return double((generator() >> 11) + 1) * 0x1.0p-53;
+			}
+
+		private:
+			size_type count_;
+			GeneratorType::result_type seed_;
+		};
+
+	}
+
+	using operators::sample_impl;
+
+	template <class TStream>
+	struct shortening::TerminatedOperatorTypeApply<TStream, operators::sample> {
+		using type = sample_impl<operators::ContainerFor<TStream, std::vector<typename TStream::ResultValueType> > >;
+	};
+
+}
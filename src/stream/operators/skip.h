@@ -12,34 +12,37 @@ namespace lipaboy_lib::stream_space {
 			using size_type = size_t;
 
 		public:
-			skip(size_type count) : count_(count) {}
+			constexpr skip(size_type count) : count_(count) {}
 
 			template <class TSubStream>
-			auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+			constexpr auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
 				skipElements<TSubStream>(stream);
 				return stream.nextElem();
 			}
 
 			template <class TSubStream>
-			void incrementSlider(TSubStream& stream) { 
+			constexpr void incrementSlider(TSubStream& stream) { 
 				skipElements<TSubStream>(stream);
 				stream.incrementSlider(); 
 			}
 
 			template <class TSubStream>
-			bool hasNext(TSubStream& stream) {
+			constexpr bool hasNext(TSubStream& stream) {
 				skipElements<TSubStream>(stream);
 				return stream.hasNext(); 
 			}
 
-			size_type count() const { return count_; }
+			constexpr size_type count() const { return count_; }
 
 		private:
 			template <class TSubStream>
-			void skipElements(TSubStream& stream) {
+			constexpr void skipElements(TSubStream& stream) {
 				if (!isSkipped) {
-					for (size_type i = 0; i < count() && stream.hasNext(); i++)
-						stream.incrementSlider();
+					if constexpr (TSubStream::isRandomAccess())
+						stream.advanceSlider(count());
+					else
+						for (size_type i = 0; i < count() && stream.hasNext(); i++)
+							stream.incrementSlider();
 					isSkipped = true;
 				}
 			}
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "tools.h"
+
+#include <vector>
+#include <array>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <limits>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		using std::vector;
+
+		// Contract rules :
+		//	1) sorted_radix(keyFn) sorts elements by ascending of keyFn(elem) (LSD radix sort by bytes).
+		//		Key must be integral or floating point. It is mapped to unsigned integer
+		//		of the same width with the same order (see RadixKey below).
+		//	2) Sorting is stable: elements with equal keys keep the input order.
+		//	3) All the elements are pulled into buffer at the first request, so the stream must be finite.
+		//		Elements must be movable.
+		//	4) keyFn is called once per element: keys are projected into records (key, index of element),
+		//		records are sorted and then elements are moved once into their places.
+		//		Small trivial elements (trivially copyable, default constructible, not larger than the key)
+		//		are sorted directly instead: moving them is cheaper than moving records, but keyFn is called
+		//		once per element in each pass then, so it must be a cheap projection without side effects.
+		//		Histograms of all the bytes are counted by one pass and passes over bytes
+		//		which are equal for all the keys are skipped.
+		//	5) If 'threads' is more than one then counting and scattering are done by several threads
+		//		(every thread processes its own chunk of buffer). Histograms of chunks for the next pass
+		//		are counted while scattering. keyFn is called concurrently for small trivial elements only.
+		//	6) Buffers and histograms are allocated by memory resource of stream if it is set (see with_resource.h).
+		//		They are allocated by the consuming thread only (memory resources aren't thread-safe).
+
+		// Info: maps the key to unsigned integer with the same order:
+		//		 signed integers - by flipping the sign bit,
+		//		 floating points - by flipping the sign bit of positives and all the bits of negatives
+		//		 (-0.0 goes before +0.0, NaNs go to the ends according to their sign).
+		template <class Key, class = void>
+		struct RadixKey;
+
+		template <class Key>
+		struct RadixKey<Key, std::enable_if_t<std::is_integral_v<Key> && !std::is_same_v<Key, bool> > > {
+			using type = std::make_unsigned_t<Key>;
+
+			static constexpr type map(Key key) {
+				if constexpr (std::is_signed_v<Key>)
+					return static_cast<type>(key) ^ (type(1) << (sizeof(type) * CHAR_BIT - 1));
+				else
+					return key;
+			}
+		};
+
+		template <class Key>
+		struct RadixKey<Key, std::enable_if_t<std::is_floating_point_v<Key> > > {
+			static_assert(sizeof(Key) == sizeof(uint32_t) || sizeof(Key) == sizeof(uint64_t),
+				"Stream.SortedRadix error: floating point key must be 32- or 64-bit wide");
+
+			using type = std::conditional_t<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+			static type map(Key key) {
+				type bits;
+				std::memcpy(&bits, &key, sizeof(bits));
+				constexpr type signBit = type(1) << (sizeof(type) * CHAR_BIT - 1);
+				return (bits & signBit) ? ~bits : (bits | signBit);
+			}
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class KeyFn>
+		struct sorted_radix : FunctorHolder<KeyFn>, TReturnSameType
+		{
+		public:
+			using size_type = size_t;
+
+		public:
+			sorted_radix(KeyFn keyFn, size_type threads = 1)
+				: FunctorHolder<KeyFn>(keyFn),
+				threads_(threads)
+			{
+				if (threads == 0)
+					throw std::logic_error("Parameter of sorted_radix (threads) must be positive");
+			}
+
+			size_type threads() const { return threads_; }
+
+		private:
+			size_type threads_;
+		};
+
+		// Info: Allocator is polymorphic one if stream has memory resource (see with_resource.h)
+		template <class KeyFn, class T, class Allocator = std::allocator<T> >
+		struct sorted_radix_impl : FunctorHolder<KeyFn>, TReturnSameType
+		{
+		public:
+			using size_type = size_t;
+			using KeyType = std::decay_t<std::invoke_result_t<KeyFn, T const &> >;
+			using UKeyType = typename RadixKey<KeyType>::type;
+
+			static constexpr size_type RADIX = 256;
+			static constexpr size_type PASSES = sizeof(UKeyType);
+			// minimal count of elements per thread
+			static constexpr size_type MIN_CHUNK_SIZE = 1 << 16;
+
+			using HistogramType = std::array<size_type, RADIX>;
+			using BufferType = vector<T, Allocator>;
+
+			// Info: small trivial elements are cheaper to move than records (key, index),
+			//		 so they are sorted directly and their keys are projected again by every pass
+			static constexpr bool IS_SORTED_DIRECTLY = std::is_trivially_copyable_v<T>
+				&& std::is_default_constructible_v<T> && sizeof(T) <= sizeof(UKeyType);
+
+			static_assert(std::is_move_constructible_v<T>, "Stream.SortedRadix error: elements must be movable");
+
+		public:
+			sorted_radix_impl(sorted_radix<KeyFn> const & obj)
+				: FunctorHolder<KeyFn>(obj.functor()),
+				threads_(obj.threads())
+			{}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> T {
+				fill(stream);
+				return std::move((*elems_)[pos_++]);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				fill(stream);
+				pos_++;
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				fill(stream);
+				return pos_ < elems_->size();
+			}
+
+			size_type threads() const { return threads_; }
+
+		private:
+			template <class TSubStream>
+			void fill(TSubStream& stream) {
+				if (isFilled_)
+					return;
+				isFilled_ = true;
+				auto & elems = elems_.get(stream);
+				if constexpr (TSubStream::isRandomAccess())
+					elems.reserve(stream.restSize());
+				while (stream.hasNext())
+					elems.push_back(stream.nextElem());
+				if (elems.size() < 2)
+					return;
+				if constexpr (IS_SORTED_DIRECTLY)
+					sortItems(elems, [keyFn = this->functor()](T const & elem) {
+						return RadixKey<KeyType>::map(keyFn(elem));
+					});
+				else if (elems.size() <= std::numeric_limits<uint32_t>::max())
+					sortByRecords<uint32_t>(elems);
+				else
+					sortByRecords<size_type>(elems);
+			}
+
+			static size_type digit(UKeyType key, size_type pass) {
+				return static_cast<size_type>((key >> (pass * CHAR_BIT)) & (RADIX - 1));
+			}
+
+			template <class Index>
+			struct Record {
+				UKeyType key;
+				Index index;
+			};
+
+			// Info: keys are projected once into records (key, index of element), records are sorted
+			//		 and then elements are moved once into their places
+			template <class Index>
+			void sortByRecords(BufferType & elems) const {
+				using RecordsType = vector<Record<Index>, RebindAllocator<Allocator, Record<Index> > >;
+				const size_type size = elems.size();
+				RecordsType records(size, elems.get_allocator());
+				auto keyFn = this->functor();
+				for (size_type i = 0; i < size; i++)
+					records[i] = { RadixKey<KeyType>::map(keyFn(static_cast<T const &>(elems[i]))), static_cast<Index>(i) };
+				if (!sortItems(records, [](Record<Index> const & record) { return record.key; }))
+					return;
+
+				BufferType sorted(elems.get_allocator());
+				sorted.reserve(size);
+				for (auto const & record : records)
+					sorted.push_back(std::move(elems[record.index]));
+				elems.swap(sorted);
+			}
+
+			// Info: sorts items stably by key(item). Returns false if all the keys are equal (nothing is moved).
+			template <class Items, class Key>
+			bool sortItems(Items & items, Key key) const {
+				const size_type size = items.size();
+				const size_type chunks = std::max<size_type>(1, std::min(threads(), size / MIN_CHUNK_SIZE));
+				const size_type chunkSize = size / chunks;
+				auto chunkBegin = [chunkSize](size_type chunk) { return chunkSize * chunk; };
+				auto chunkEnd = [size, chunks, chunkSize](size_type chunk) {
+					return (chunk + 1 == chunks) ? size : chunkSize * (chunk + 1);
+				};
+				auto allocator = items.get_allocator();
+
+				// histograms of all the digits of every chunk by one pass
+				using HistogramsType = std::array<HistogramType, PASSES>;
+				vector<HistogramsType, RebindAllocator<Allocator, HistogramsType> > counts(chunks, allocator);
+				runChunks(chunks, [&](size_type chunk) {
+					auto & histograms = counts[chunk];
+					for (auto & histogram : histograms)
+						histogram.fill(0);
+					for (size_type i = chunkBegin(chunk); i < chunkEnd(chunk); i++) {
+						const UKeyType k = key(items[i]);
+						for (size_type pass = 0; pass < PASSES; pass++)
+							histograms[pass][digit(k, pass)]++;
+					}
+				});
+
+				// passes over bytes which are equal for all the keys are skipped
+				const UKeyType firstKey = key(items[0]);
+				std::array<size_type, PASSES> passes;
+				size_type passCount = 0;
+				for (size_type pass = 0; pass < PASSES; pass++) {
+					size_type sameDigitCount = 0;
+					for (size_type chunk = 0; chunk < chunks; chunk++)
+						sameDigitCount += counts[chunk][pass][digit(firstKey, pass)];
+					if (sameDigitCount != size)
+						passes[passCount++] = pass;
+				}
+				if (passCount == 0)
+					return false;
+
+				Items buffer(size, allocator);
+				// offsets of digits in every chunk
+				vector<HistogramType, RebindAllocator<Allocator, HistogramType> > offsets(chunks, allocator);
+				// Info: order of elements of chunk inside the bucket depends on chunk's position,
+				//		 so histograms of the next pass are counted while scattering
+				//		 (by every writing chunk for every chunk of destination)
+				vector<HistogramType, RebindAllocator<Allocator, HistogramType> > nextCounts(
+					(chunks > 1) ? chunks * chunks : 0, allocator);
+
+				for (size_type p = 0; p < passCount; p++) {
+					const size_type pass = passes[p];
+					// one chunk keeps all the elements, so its histograms are valid for every pass
+					const bool isCountedBefore = p == 0 || chunks == 1;
+					size_type offset = 0;
+					for (size_type d = 0; d < RADIX; d++)
+						for (size_type chunk = 0; chunk < chunks; chunk++) {
+							size_type count = isCountedBefore ? counts[chunk][pass][d] : 0;
+							if (!isCountedBefore)
+								for (size_type writer = 0; writer < chunks; writer++)
+									count += nextCounts[writer * chunks + chunk][d];
+							offsets[chunk][d] = offset;
+							offset += count;
+						}
+
+					const bool isNextCounted = chunks > 1 && p + 1 < passCount;
+					const size_type nextPass = isNextCounted ? passes[p + 1] : 0;
+					runChunks(chunks, [&](size_type chunk) {
+						auto & offset = offsets[chunk];
+						if (!isNextCounted) {
+							for (size_type i = chunkBegin(chunk); i < chunkEnd(chunk); i++)
+								buffer[offset[digit(key(items[i]), pass)]++] = std::move(items[i]);
+							return;
+						}
+						HistogramType* histograms = &nextCounts[chunk * chunks];
+						for (size_type destination = 0; destination < chunks; destination++)
+							histograms[destination].fill(0);
+						for (size_type i = chunkBegin(chunk); i < chunkEnd(chunk); i++) {
+							const UKeyType k = key(items[i]);
+							const size_type position = offset[digit(k, pass)]++;
+							buffer[position] = std::move(items[i]);
+							histograms[std::min(position / chunkSize, chunks - 1)][digit(k, nextPass)]++;
+						}
+					});
+					items.swap(buffer);
+				}
+				return true;
+			}
+
+			// Info: calls task(chunk) for every chunk, the first chunk is processed by the current thread.
+			//		 Exception thrown by task is rethrown after all the threads are finished.
+			template <class Task>
+			static void runChunks(size_type chunks, Task&& task) {
+				if (chunks == 1) {
+					task(0);
+					return;
+				}
+				vector<std::exception_ptr> errors(chunks);
+				vector<std::thread> workers;
+				workers.reserve(chunks - 1);
+				auto run = [&task, &errors](size_type chunk) {
+					try {
+						task(chunk);
+					}
+					catch (...) {
+						errors[chunk] = std::current_exception();
+					}
+				};
+				for (size_type chunk = 1; chunk < chunks; chunk++)
+					workers.emplace_back(run, chunk);
+				run(0);
+				for (auto & worker : workers)
+					worker.join();
+				for (auto & error : errors)
+					if (error)
+						std::rethrow_exception(error);
+			}
+
+		private:
+			size_type threads_;
+
+			LazyContainer<BufferType> elems_;
+			size_type pos_ = 0;
+			bool isFilled_ = false;
+		};
+
+	}
+
+	using operators::sorted_radix;
+	using operators::sorted_radix_impl;
+
+	template <class TStream, class KeyFn>
+	struct shortening::StreamTypeExtender<TStream, sorted_radix<KeyFn> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		static_assert(!remref<TStream>::isInfinite(), "Stream error: attempt to sort infinite stream");
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			sorted_radix_impl<KeyFn, typename remref<TStream>::ResultValueType,
+				operators::AllocatorFor<remref<TStream>, typename remref<TStream>::ResultValueType> > >;
+	};
+
+}
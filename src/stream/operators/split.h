@@ -64,15 +64,17 @@ namespace lipaboy_lib::stream_space {
 				split_impl(SplitPredicate splitFunctor) 
 					: FunctorHolder<SplitPredicate>(splitFunctor) 
 				{}
+			// Info: container of split can be replaced by std::pmr one (see with_resource.h)
+			template <class TOtherContainer>
 			explicit
-				split_impl(split<TContainer> obj)
+				split_impl(split<TOtherContainer> obj)
 					: FunctorHolder<SplitPredicate>(obj.functor())
 				{}
 
 			template <class TSubStream>
 			auto nextElem(TSubStream& stream) -> ReturnType
 			{
-				ReturnType part;
+				ReturnType part = makeContainer<ReturnType>(stream);
 
 				for (size_type i = 0; stream.hasNext(); i++) {
 					auto temp = stream.nextElem();
@@ -120,7 +122,7 @@ namespace lipaboy_lib::stream_space {
 		using type = typename remref<TStream>::template ExtendedStreamType<
 			remref<
 				split_impl<typename split<TContainer>::SplitPredicate,
-					typename split<TContainer>::ContainerType
+					operators::ContainerFor<TStream, typename split<TContainer>::ContainerType>
 				>
 				//split_impl<std::function<bool(char)>, std::string>
 			>
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "tools.h"
+#include "containers/kll_sketch.h"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <optional>
+
+namespace lipaboy_lib::stream_space {
+
+	// Contract rules :
+	//	1) Stream elements must be arithmetic (they are converted to double for mean and variance).
+	//	2) Mean and variance are computed by blocks and merged into result by Chan's formula
+	//		(parallel variant of Welford's algorithm). It is numerically stable like Welford's one
+	//		but hasn't dependency on every element. Inside block, sum, M2 and min/max are accumulated
+	//		by LANES independent lanes (branch-free) which are merged at the end of block,
+	//		so the loops are vectorized without reassociation of floating-point additions
+	//		(checked with GCC -O2/-O3 -fopt-info-vec for float, double and int elements).
+	//	3) Quantiles are approximate (KLL sketch), memory is bounded by sketch parameter k.
+	//	4) NaN elements are skipped (they have no order) and only counted by nanCount().
+	//	5) Sketch is allocated by memory resource of stream if it is set (see with_resource.h).
+
+	//------------------------------------------------------------------------------------------------//
+	//-----------------------------------Terminated operation-----------------------------------------//
+	//------------------------------------------------------------------------------------------------//
+
+	namespace operators {
+
+		template <class T, class Allocator = std::allocator<T> >
+		class Statistics {
+		public:
+			using size_type = size_t;
+			using SketchType = KLLSketch<T, Allocator>;
+
+		public:
+			explicit
+				Statistics(size_type sketchK, Allocator const & allocator = Allocator())
+					: sketch_(sketchK, allocator)
+			{}
+
+			uint64_t count() const { return count_; }
+			// count of skipped NaN elements
+			uint64_t nanCount() const { return nanCount_; }
+			bool empty() const { return count_ == 0; }
+			double mean() const { return mean_; }
+			// population variance
+			double variance() const { return (count_ > 0) ? m2_ / double(count_) : 0.; }
+			double sampleVariance() const { return (count_ > 1) ? m2_ / double(count_ - 1) : 0.; }
+			std::optional<T> min() const { return empty() ? std::nullopt : std::optional<T>(min_); }
+			std::optional<T> max() const { return empty() ? std::nullopt : std::optional<T>(max_); }
+			// approximate quantile, q in [0, 1]
+			std::optional<T> quantile(double q) const {
+				return empty() ? std::nullopt : std::optional<T>(sketch_.quantile(q));
+			}
+			SketchType const & sketch() const { return sketch_; }
+
+			//---------------Updating---------------//
+
+			void update(T const * values, size_type size) {
+				if constexpr (std::is_floating_point_v<T>) {
+					size_type nanCount = 0;
+					for (size_type i = 0; i < size; i++)
+						nanCount += (values[i] != values[i]);
+					if (nanCount > 0) {
+						std::vector<T, Allocator> numbers(sketch_.get_allocator());
+						numbers.reserve(size - nanCount);
+						std::copy_if(values, values + size, std::back_inserter(numbers),
+							[](T value) { return value == value; });
+						nanCount_ += nanCount;
+						updateByNumbers(numbers.data(), numbers.size());
+						return;
+					}
+				}
+				updateByNumbers(values, size);
+			}
+
+			void merge(Statistics const & other) {
+				nanCount_ += other.nanCount_;
+				if (other.empty())
+					return;
+				merge(other.count_, other.mean_, other.m2_, other.min_, other.max_);
+				sketch_.merge(other.sketch_);
+			}
+
+		private:
+			static constexpr size_type LANES = 4;
+
+			void updateByNumbers(T const * values, size_type size) {
+				if (size == 0)
+					return;
+
+				std::array<double, LANES> sums = {};
+				std::array<T, LANES> mins;
+				std::array<T, LANES> maxs;
+				mins.fill(values[0]);
+				maxs.fill(values[0]);
+				size_type i = 0;
+				for (; i + LANES <= size; i += LANES) {
+					// Info: GCC unrolls the lane loop before vectorizing at -O3 and can't vectorize it then
+#if defined(__GNUC__)
+#pragma GCC unroll 1
+#endif
+					for (size_type lane = 0; lane < LANES; lane++) {
+						const T value = values[i + lane];
+						sums[lane] += double(value);
+						mins[lane] = (value < mins[lane]) ? value : mins[lane];
+						maxs[lane] = (maxs[lane] < value) ? value : maxs[lane];
+					}
+				}
+				for (; i < size; i++) {
+					sums[0] += double(values[i]);
+					mins[0] = (values[i] < mins[0]) ? values[i] : mins[0];
+					maxs[0] = (maxs[0] < values[i]) ? values[i] : maxs[0];
+				}
+				double blockSum = 0.;
+				T blockMin = mins[0];
+				T blockMax = maxs[0];
+				for (size_type lane = 0; lane < LANES; lane++) {
+					blockSum += sums[lane];
+					blockMin = std::min(blockMin, mins[lane]);
+					blockMax = std::max(blockMax, maxs[lane]);
+				}
+
+				const double blockMean = blockSum / double(size);
+				std::array<double, LANES> m2s = {};
+				for (i = 0; i + LANES <= size; i += LANES) {
+#if defined(__GNUC__)
+#pragma GCC unroll 1
+#endif
+					for (size_type lane = 0; lane < LANES; lane++) {
+						const double delta = double(values[i + lane]) - blockMean;
+						m2s[lane] += delta * delta;
+					}
+				}
+				for (; i < size; i++) {
+					const double delta = double(values[i]) - blockMean;
+					m2s[0] += delta * delta;
+				}
+				double blockM2 = 0.;
+				for (size_type lane = 0; lane < LANES; lane++)
+					blockM2 += m2s[lane];
+
+				for (i = 0; i < size; i++)
+					sketch_.update(values[i]);
+
+				merge(size, blockMean, blockM2, blockMin, blockMax);
+			}
+
+			void merge(uint64_t count, double mean, double m2, T min, T max) {
+				if (empty()) {
+					min_ = min;
+					max_ = max;
+				}
+				else {
+					min_ = std::min(min_, min);
+					max_ = std::max(max_, max);
+				}
+				const uint64_t total = count_ + count;
+				const double delta = mean - mean_;
+				mean_ += delta * double(count) / double(total);
+				m2_ += m2 + delta * delta * double(count_) * double(count) / double(total);
+				count_ = total;
+			}
+
+		private:
+			uint64_t count_ = 0;
+			uint64_t nanCount_ = 0;
+			double mean_ = 0.;
+			double m2_ = 0.;
+			T min_ = T();
+			T max_ = T();
+			SketchType sketch_;
+		};
+
+		struct stats : TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			template <class T>
+			using RetType = Statistics<T>;
+
+		public:
+			stats(size_type sketchK = 200) : sketchK_(sketchK) {}
+
+			size_type sketchK() const { return sketchK_; }
+
+		private:
+			size_type sketchK_;
+		};
+
+		// Info: Allocator is polymorphic one if stream has memory resource (see with_resource.h)
+		template <class Allocator>
+		struct stats_impl : TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+			static constexpr size_type BLOCK_SIZE = 64;
+
+			template <class T>
+			using RetType = Statistics<T, Allocator>;
+
+		public:
+			stats_impl(stats const & obj) : sketchK_(obj.sketchK()) {}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				return applyByAccumulating<Stream_>(*this, obj);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			struct AccumulatorType {
+				RetType<T> result;
+				std::array<T, BLOCK_SIZE> block;
+				size_type blockSize = 0;
+			};
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				static_assert(std::is_arithmetic_v<T>, "Stream.Stats error: elements must be arithmetic");
+				return AccumulatorType<T>{ RetType<T>(sketchK()), {}, 0 };
+			}
+			// sketch is allocated by resource of stream
+			template <class T, class Stream_>
+			AccumulatorType<T> initAccumulator(Stream_ & stream) const {
+				static_assert(std::is_arithmetic_v<T>, "Stream.Stats error: elements must be arithmetic");
+				return AccumulatorType<T>{ RetType<T>(sketchK(), makeAllocator<Allocator>(stream)), {}, 0 };
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				accumulator.block[accumulator.blockSize++] = elem;
+				if (accumulator.blockSize == BLOCK_SIZE) {
+					accumulator.result.update(accumulator.block.data(), accumulator.blockSize);
+					accumulator.blockSize = 0;
+				}
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & accumulator) const {
+				accumulator.result.update(accumulator.block.data(), accumulator.blockSize);
+				accumulator.blockSize = 0;
+				return std::move(accumulator.result);
+			}
+
+			size_type sketchK() const { return sketchK_; }
+
+		private:
+			size_type sketchK_;
+		};
+
+	}
+
+	using operators::Statistics;
+	using operators::stats_impl;
+
+	template <class TStream>
+	struct shortening::TerminatedOperatorTypeApply<TStream, operators::stats> {
+		using type = stats_impl<operators::AllocatorFor<TStream, typename TStream::ResultValueType> >;
+	};
+
+}
@@ -2,6 +2,12 @@
 
 #include "tools.h"
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
 namespace lipaboy_lib::stream_space {
 
 	namespace operators {
@@ -11,27 +17,291 @@ namespace lipaboy_lib::stream_space {
 		template <class TInit = void*>
 		struct sum : TReturnSameType, TerminatedOperator
 		{
-            sum(TInit init = nullptr) {
-				init_ = init;
-			}
+			constexpr sum(TInit init = nullptr) : init_(init) {}
 
 			template <class TStream>
-			auto apply(TStream & stream) -> typename TStream::ResultValueType
+			constexpr auto apply(TStream & stream) -> typename TStream::ResultValueType
 			{
-				using TResult = typename TStream::ResultValueType;
-				TResult result;
+				return applyByAccumulating<TStream>(*this, stream);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = T;
+
+			template <class T>
+			constexpr AccumulatorType<T> initAccumulator() const {
 				if constexpr (std::is_same_v<TInit, void*>)
-					result = TResult();
+					return T();
 				else
-					result = init_;
-				while (stream.hasNext())
-					result += stream.nextElem();
-				return result;
+					return AccumulatorType<T>(init_);
 			}
 
+			template <class T, class Elem_>
+			constexpr void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				accumulator += std::forward<Elem_>(elem);
+			}
+
+			template <class T>
+			constexpr T finish(AccumulatorType<T> & accumulator) const { return std::move(accumulator); }
+
 			TInit init_;
 		};
 
+		// Contract rules :
+		//	1) sum_pairwise() and sum_kahan() are for floating point elements.
+		//	2) Consecutive elements are added to LANES independent accumulators by turns,
+		//		so there is no dependency chain through every element (unlike sum()).
+		//		apply() pulls LANES elements per iteration into local accumulators (they are kept
+		//		in registers), Accumulate API (for multi) does the same through accumulator object.
+		//		Don't compile with -ffast-math: it removes the compensation of sum_kahan.
+		//	3) sum_pairwise: block of BLOCK_SIZE elements is summed by lanes (lanes are added pairwise),
+		//		sums of blocks are added by binary counter (pairwise summation), so error grows
+		//		like O(eps * log n) instead of O(eps * n) for serial sum.
+		//	4) sum_kahan: every lane accumulates exact rounding errors of its additions (Knuth's TwoSum),
+		//		so error is O(eps) independently on count of elements (like for Neumaier's sum).
+		//		TwoSum has no comparison, so per-lane update is branch-free. Lanes are merged by Neumaier's sum.
+
+		// Info: pulls next LANES elements and calls add(lane, elem) for them (loop is unrolled).
+		//		 Returns false if the stream is over. Unchecked variant is used when
+		//		 count of rest elements is known (random access source).
+		template <bool isChecked = true, class TStream, class Add, size_t... Lanes>
+		bool pullByLanes(TStream & stream, Add&& add, std::index_sequence<Lanes...>) {
+			if constexpr (isChecked)
+				return ((stream.hasNext() && (add(Lanes, stream.nextElem()), true)) && ...);
+			else {
+				(add(Lanes, stream.nextElem()), ...);
+				return true;
+			}
+		}
+
+		template <class T, size_t LANES>
+		T sumLanesPairwise(std::array<T, LANES> & lanes) {
+			for (size_t width = LANES / 2; width > 0; width /= 2)
+				for (size_t lane = 0; lane < width; lane++)
+					lanes[lane] += lanes[lane + width];
+			return lanes[0];
+		}
+
+		struct sum_pairwise : TReturnSameType, TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			static constexpr size_type BLOCK_SIZE = 128;
+			static constexpr size_type LANES = 8;
+			// more than enough levels of binary counter for 64-bit count of blocks
+			static constexpr size_type LEVELS = 64;
+
+			// Info: level k of binary counter keeps sum of 2^k blocks if k-th bit of count is set
+			template <class T>
+			struct BinaryCounter {
+				std::array<T, LEVELS> levels = {};
+				uint64_t count = 0;
+
+				void add(T sum) {
+					size_type level = 0;
+					for (; (count >> level) & 1; level++)
+						sum = levels[level] + sum;
+					levels[level] = sum;
+					count++;
+				}
+				T result() const {
+					T result = T();
+					for (size_type level = 0; level < LEVELS; level++)
+						if ((count >> level) & 1)
+							result += levels[level];
+					return result;
+				}
+			};
+
+		public:
+			template <class TStream>
+			auto apply(TStream & stream) -> typename TStream::ResultValueType
+			{
+				using T = typename TStream::ResultValueType;
+				static_assert(std::is_floating_point_v<T>, "Stream.SumPairwise error: elements must be floating point");
+
+				BinaryCounter<T> counter;
+				if constexpr (TStream::isRandomAccess()) {
+					for (size_type blocks = stream.restSize() / BLOCK_SIZE; blocks > 0; blocks--) {
+						std::array<T, LANES> lanes = {};
+						for (size_type i = 0; i < BLOCK_SIZE; i += LANES)
+							pullByLanes<false>(stream,
+								[&lanes](size_type lane, T elem) { lanes[lane] += elem; },
+								std::make_index_sequence<LANES>());
+						counter.add(sumLanesPairwise(lanes));
+					}
+				}
+				bool hasNext = true;
+				while (hasNext) {
+					std::array<T, LANES> lanes = {};
+					for (size_type i = 0; i < BLOCK_SIZE && hasNext; i += LANES)
+						hasNext = pullByLanes(stream,
+							[&lanes](size_type lane, T elem) { lanes[lane] += elem; },
+							std::make_index_sequence<LANES>());
+					counter.add(sumLanesPairwise(lanes));
+				}
+				return counter.result();
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			struct AccumulatorType {
+				BinaryCounter<T> counter;
+				std::array<T, LANES> lanes = {};
+				size_type blockSize = 0;
+			};
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				static_assert(std::is_floating_point_v<T>, "Stream.SumPairwise error: elements must be floating point");
+				return AccumulatorType<T>();
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				accumulator.lanes[accumulator.blockSize % LANES] += elem;
+				if (++accumulator.blockSize == BLOCK_SIZE) {
+					accumulator.counter.add(sumLanesPairwise(accumulator.lanes));
+					accumulator.lanes = {};
+					accumulator.blockSize = 0;
+				}
+			}
+
+			template <class T>
+			T finish(AccumulatorType<T> & accumulator) const {
+				accumulator.counter.add(sumLanesPairwise(accumulator.lanes));
+				accumulator.lanes = {};
+				accumulator.blockSize = 0;
+				return accumulator.counter.result();
+			}
+		};
+
+		struct sum_kahan : TReturnSameType, TerminatedOperator
+		{
+		public:
+			using size_type = size_t;
+
+			static constexpr size_type LANES = 8;
+
+			// Neumaier's compensated sum (it's used for merging of lanes only)
+			template <class T>
+			struct CompensatedSum {
+				T sum = T();
+				T compensation = T();
+
+				void add(T elem) {
+					const T temp = sum + elem;
+					compensation += (std::abs(sum) >= std::abs(elem)) ? (sum - temp) + elem : (elem - temp) + sum;
+					sum = temp;
+				}
+				T result() const { return sum + compensation; }
+			};
+
+			// Info: lanes are stored and updated by pairs (neighbour lanes are in one array),
+			//		 so the compiler packs every pair into one vector register
+			//		 and keeps all the sums and compensations in registers.
+			//		 Loop over the pair mustn't be unrolled: GCC -O3 unrolls it before vectorizing
+			//		 and scalarizes the lanes then.
+			template <class T>
+			struct Lanes {
+				static constexpr size_type PAIR = 2;
+
+				std::array<std::array<T, PAIR>, LANES / PAIR> sums = {};
+				std::array<std::array<T, PAIR>, LANES / PAIR> compensations = {};
+
+				void add(size_type lane, T elem) {
+					addTwoSum(sums[lane / PAIR][lane % PAIR], compensations[lane / PAIR][lane % PAIR], elem);
+				}
+				// Info: pulls next LANES elements (stream must have them)
+				template <class TStream>
+				void addNext(TStream & stream) {
+					addNextByPairs(stream, std::make_index_sequence<LANES / PAIR>());
+				}
+				T sum(size_type lane) const { return sums[lane / PAIR][lane % PAIR]; }
+				T compensation(size_type lane) const { return compensations[lane / PAIR][lane % PAIR]; }
+
+			private:
+				// Knuth's TwoSum: exact rounding error of addition without comparison (no jumps)
+				static void addTwoSum(T & sum, T & compensation, T elem) {
+					const T temp = sum + elem;
+					const T virtualElem = temp - sum;
+					compensation += (sum - (temp - virtualElem)) + (elem - virtualElem);
+					sum = temp;
+				}
+				template <class TStream, size_t... Pairs>
+				void addNextByPairs(TStream & stream, std::index_sequence<Pairs...>) {
+					(addNextPair(Pairs, stream), ...);
+				}
+				template <class TStream>
+				void addNextPair(size_type pair, TStream & stream) {
+#if defined(__GNUC__)
+#pragma GCC unroll 1
+#endif
+					for (size_type i = 0; i < PAIR; i++)
+						addTwoSum(sums[pair][i], compensations[pair][i], stream.nextElem());
+				}
+			};
+
+		public:
+			template <class TStream>
+			auto apply(TStream & stream) -> typename TStream::ResultValueType
+			{
+				using T = typename TStream::ResultValueType;
+				static_assert(std::is_floating_point_v<T>, "Stream.SumKahan error: elements must be floating point");
+
+				Lanes<T> lanes;
+				if constexpr (TStream::isRandomAccess())
+					for (size_type groups = stream.restSize() / LANES; groups > 0; groups--)
+						lanes.addNext(stream);
+				while (pullByLanes(stream,
+						[&lanes](size_type lane, T elem) { lanes.add(lane, elem); },
+						std::make_index_sequence<LANES>()))
+				{}
+				return merge(lanes);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			struct AccumulatorType {
+				Lanes<T> lanes;
+				size_type lane = 0;
+			};
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const {
+				static_assert(std::is_floating_point_v<T>, "Stream.SumKahan error: elements must be floating point");
+				return AccumulatorType<T>();
+			}
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & accumulator, Elem_&& elem) const {
+				accumulator.lanes.add(accumulator.lane, elem);
+				accumulator.lane = (accumulator.lane + 1) % LANES;
+			}
+
+			template <class T>
+			T finish(AccumulatorType<T> & accumulator) const { return merge(accumulator.lanes); }
+
+		private:
+			template <class T>
+			static T merge(Lanes<T> const & lanes) {
+				CompensatedSum<T> result;
+				for (size_type lane = 0; lane < LANES; lane++) {
+					result.add(lanes.sum(lane));
+					result.compensation += lanes.compensation(lane);
+				}
+				return result.result();
+			}
+		};
+
 	}
 
+	using operators::sum_pairwise;
+	using operators::sum_kahan;
+
 }
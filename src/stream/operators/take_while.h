@@ -0,0 +1,155 @@
+#pragma once
+
+#include "tools.h"
+#include "filter.h"
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) take_while gives elements while predicate is true. The first element which
+		//		fails the predicate is pulled from sub-stream but it is not given.
+		//		Makes infinite stream finite.
+		//	2) drop_while skips elements while predicate is true and gives the rest of stream
+		//		without checking.
+		//	3) Element that is checked by hasNext() is kept into the operator
+		//		(inline storage for trivial types, reused allocation for others, see filter.h).
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class Predicate>
+		struct take_while : FunctorHolder<Predicate>, TReturnSameType, FixSizeOperator
+		{
+		public:
+			constexpr take_while(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+		};
+
+		template <class Predicate, class T>
+		struct take_while_impl : FunctorHolder<Predicate>, TReturnSameType, FixSizeOperator
+		{
+		public:
+			constexpr take_while_impl(take_while<Predicate> obj)
+				: FunctorHolder<Predicate>(obj.functor())
+			{}
+
+			template <class TSubStream>
+			constexpr auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+				hasNext(stream);
+				return currentElem_.take();
+			}
+
+			template <class TSubStream>
+			constexpr void incrementSlider(TSubStream& stream) {
+				hasNext(stream);
+				currentElem_.reset();
+			}
+
+			template <class TSubStream>
+			constexpr bool hasNext(TSubStream& stream) {
+				if (isStopped_)
+					return false;
+				if (!currentElem_.empty())
+					return true;
+				if (stream.hasNext()) {
+					currentElem_.bind(stream);
+					currentElem_.set(stream.nextElem());
+					if (FunctorHolder<Predicate>::functor()(*currentElem_))
+						return true;
+					currentElem_.reset();
+				}
+				isStopped_ = true;
+				return false;
+			}
+
+		private:
+			CurrentElemHolder<T> currentElem_;
+			bool isStopped_ = false;
+		};
+
+		template <class Predicate>
+		struct drop_while : FunctorHolder<Predicate>, TReturnSameType
+		{
+		public:
+			constexpr drop_while(Predicate functor) : FunctorHolder<Predicate>(functor) {}
+		};
+
+		template <class Predicate, class T>
+		struct drop_while_impl : FunctorHolder<Predicate>, TReturnSameType
+		{
+		public:
+			constexpr drop_while_impl(drop_while<Predicate> obj)
+				: FunctorHolder<Predicate>(obj.functor())
+			{}
+
+			template <class TSubStream>
+			constexpr auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+				dropElements(stream);
+				if (currentElem_.empty())
+					return stream.nextElem();
+				return currentElem_.take();
+			}
+
+			template <class TSubStream>
+			constexpr void incrementSlider(TSubStream& stream) {
+				dropElements(stream);
+				if (currentElem_.empty())
+					stream.incrementSlider();
+				else
+					currentElem_.reset();
+			}
+
+			template <class TSubStream>
+			constexpr bool hasNext(TSubStream& stream) {
+				dropElements(stream);
+				return !currentElem_.empty() || stream.hasNext();
+			}
+
+		private:
+			template <class TSubStream>
+			constexpr void dropElements(TSubStream& stream) {
+				if (isDropped_)
+					return;
+				isDropped_ = true;
+				currentElem_.bind(stream);
+				while (stream.hasNext()) {
+					currentElem_.set(stream.nextElem());
+					if (!FunctorHolder<Predicate>::functor()(*currentElem_))
+						return;
+				}
+				currentElem_.reset();
+			}
+
+		private:
+			CurrentElemHolder<T> currentElem_;
+			bool isDropped_ = false;
+		};
+
+	}
+
+	using operators::take_while;
+	using operators::take_while_impl;
+	using operators::drop_while;
+	using operators::drop_while_impl;
+
+	template <class TStream, class Predicate>
+	struct shortening::StreamTypeExtender<TStream, take_while<Predicate> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			take_while_impl<Predicate, typename remref<TStream>::ResultValueType> >;
+	};
+
+	template <class TStream, class Predicate>
+	struct shortening::StreamTypeExtender<TStream, drop_while<Predicate> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			drop_while_impl<Predicate, typename remref<TStream>::ResultValueType> >;
+	};
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "tools.h"
+
+#include <array>
+#include <stdexcept>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Elements are stored inline, so the terminal can be used in constant expressions.
+		//	2) If stream has less than N elements then the rest of array is value-initialized.
+		//	3) If stream has more than N elements then exception is thrown
+		//		(compilation error in constant expression).
+
+		template <size_t N>
+		struct to_array : TerminatedOperator
+		{
+		public:
+			template <class T>
+			using RetType = std::array<T, N>;
+		public:
+
+			template <class Stream_>
+			constexpr auto apply(Stream_ & obj) -> RetType<typename Stream_::ResultValueType>
+			{
+				return applyByAccumulating<Stream_>(*this, obj);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			struct AccumulatorType {
+				RetType<T> elems = RetType<T>();
+				size_t size = 0;
+			};
+
+			template <class T>
+			constexpr AccumulatorType<T> initAccumulator() const { return AccumulatorType<T>(); }
+
+			template <class T, class Elem_>
+			constexpr void accumulate(AccumulatorType<T> & toArray, Elem_&& elem) const {
+				if (toArray.size >= N)
+					throw std::length_error("Stream has more elements than size of to_array");
+				toArray.elems[toArray.size++] = std::forward<Elem_>(elem);
+			}
+
+			template <class T>
+			constexpr RetType<T> finish(AccumulatorType<T> & toArray) const { return std::move(toArray.elems); }
+
+		};
+
+	}
+
+}
@@ -28,10 +28,10 @@ namespace lipaboy_lib::stream_space {
             }
 
             template <class StreamType>
-            void incrementElem(StreamType& stream)
+            void incrementSlider(StreamType& stream)
             {
-                stream.incrementElem();
-                second_.nextElem();
+                stream.incrementSlider();
+                second_.incrementSlider();
             }
 
             template <class StreamType>
@@ -20,15 +20,73 @@ namespace lipaboy_lib::stream_space {
 			template <class Stream_>
 			auto apply(Stream_ & obj) -> vector<typename Stream_::ResultValueType>
 			{
-				using ToVectorType = vector<typename Stream_::ResultValueType>;
-				ToVectorType toVector;
-				for (; obj.hasNext(); )
-					toVector.push_back(obj.nextElem());
-				return std::move(toVector);
+				return applyByAccumulating<Stream_>(*this, obj);
 			}
 
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = vector<T>;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return AccumulatorType<T>(); }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & toVector, Elem_&& elem) const {
+				toVector.push_back(std::forward<Elem_>(elem));
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & toVector) const { return std::move(toVector); }
+
+		};
+
+		// Info: it is applied instead of to_vector if stream has memory resource (see with_resource.h)
+		template <class TVector>
+		struct to_vector_impl : TerminatedOperator
+		{
+		public:
+			template <class T>
+			using RetType = TVector;
+		public:
+			to_vector_impl(to_vector) {}
+
+			template <class Stream_>
+			auto apply(Stream_ & obj) -> TVector
+			{
+				return applyByAccumulating<Stream_>(*this, obj);
+			}
+
+			//-----------------Accumulate API--------------//
+
+			template <class T>
+			using AccumulatorType = TVector;
+
+			template <class T>
+			AccumulatorType<T> initAccumulator() const { return AccumulatorType<T>(); }
+			// vector is allocated by resource of stream (e.g. when it's fed by 'multi')
+			template <class T, class Stream_>
+			AccumulatorType<T> initAccumulator(Stream_ & stream) const { return makeContainer<TVector>(stream); }
+
+			template <class T, class Elem_>
+			void accumulate(AccumulatorType<T> & toVector, Elem_&& elem) const {
+				toVector.push_back(std::forward<Elem_>(elem));
+			}
+
+			template <class T>
+			RetType<T> finish(AccumulatorType<T> & toVector) const { return std::move(toVector); }
 		};
 
 	}
 
+	using operators::to_vector;
+	using operators::to_vector_impl;
+
+	template <class TStream>
+	struct shortening::TerminatedOperatorTypeApply<TStream, to_vector> {
+		using type = lipaboy_lib::enable_if_else_t<TStream::hasMemoryResource(),
+			to_vector_impl<operators::ContainerFor<TStream, std::vector<typename TStream::ResultValueType> > >,
+			to_vector>;
+	};
+
 }
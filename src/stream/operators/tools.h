@@ -6,9 +6,18 @@
 #include <iterator>
 #include <typeinfo>
 #include <type_traits>
+#include <memory_resource>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <string>
+#include <unordered_set>
 
 namespace lipaboy_lib::stream_space {
 
+	template <class TOperator, class... Rest>
+	class StreamBase;
+
 	namespace operators {
 
 		using std::function;
@@ -30,6 +39,23 @@ namespace lipaboy_lib::stream_space {
 
 		struct TerminatedOperator {};
 
+		// Info: terminated operator that can stop pulling elements before the end of stream.
+		//		 Such operators are allowed to be applied to infinite streams.
+		struct ShortCircuitOperator {};
+
+		// Info: operator that carries memory resource for allocating operators
+		//		 of the rest of pipeline (see "stream/operators/with_resource.h").
+		struct ResourceHolderOperator {};
+
+		// Info: operator that can keep random access of stream. It says whether the stream is random access
+		//		 (static isRandomAccess<TSubStream>()) and measures and advances it
+		//		 (restSize(subStream), advanceSlider(subStream, count)), see "stream/operators/zip.h".
+		struct RandomAccessOperator {};
+
+		// Info: operator without state of pulling (e.g. map): copy of stream extended by it
+		//		 gives the same elements as the original if the sub-stream does (see IsReplayableStream).
+		struct StatelessOperator {};
+
 		template <class Functor>
 		struct FunctorMetaType {
 			using GetMetaType = Functor;
@@ -38,9 +64,9 @@ namespace lipaboy_lib::stream_space {
 		template <class Functor>
 		struct FunctorHolderDirectly : FunctorMetaType<Functor> {
 			using FunctorType = Functor;
-			FunctorHolderDirectly(FunctorType func) : functor_(func) {}
+			constexpr FunctorHolderDirectly(FunctorType func) : functor_(func) {}
 
-			FunctorType functor() const { return functor_; }
+			constexpr FunctorType functor() const { return functor_; }
 			void setFunctor(FunctorType op) { functor_ = op; }
 		private:
 			FunctorType functor_;
@@ -53,9 +79,9 @@ namespace lipaboy_lib::stream_space {
 			: FunctorMetaType< WrapBySTDFunctionType<Functor> > 
 		{
 			using FunctorType = WrapBySTDFunctionType<Functor>;
-			FunctorHolderWrapper(FunctorType func) : functor_(func) {}
+			constexpr FunctorHolderWrapper(FunctorType func) : functor_(func) {}
 
-			FunctorType functor() const { return functor_; }
+			constexpr FunctorType functor() const { return functor_; }
 			void setFunctor(FunctorType op) { functor_ = op; }
 		private:
 			FunctorType functor_;
@@ -72,9 +98,9 @@ namespace lipaboy_lib::stream_space {
 			: FunctorMetaType< WrapBySTDFunctionExcludeLambdaType<Functor> > 
 		{
 			using FunctorType = WrapBySTDFunctionExcludeLambdaType<Functor>;
-			FunctorHolderWrapperExcludeLambda(FunctorType func) : functor_(func) {}
+			constexpr FunctorHolderWrapperExcludeLambda(FunctorType func) : functor_(func) {}
 
-			FunctorType functor() const { return functor_; }
+			constexpr FunctorType functor() const { return functor_; }
 			void setFunctor(FunctorType op) { functor_ = op; }
 		private:
 			FunctorType functor_;
@@ -89,11 +115,154 @@ namespace lipaboy_lib::stream_space {
 			using Base = FunctorHolderWrapperExcludeLambda<Functor>;
 			//       : FunctorHolderWrapper<Functor>(func)
 				//: FunctorHolderDirectly<Functor>(func)
-			FunctorHolder(typename Base::FunctorType func) 
+			constexpr FunctorHolder(typename Base::FunctorType func) 
 				: Base(func)
 			{}
 		};
 
+		//---------------Accumulate API--------------//
+
+		// INFO: terminated operator can be split into three steps (see "stream/operators/operators.h"):
+		//		 initAccumulator<T>() -> accumulate<T>(accumulator, elem) -> finish<T>(accumulator).
+		//		 Such operators can be fed by one element at a time (e.g. by 'multi' operator).
+		//		 Operator that allocates its accumulator by memory resource of stream
+		//		 can take the stream: initAccumulator<T>(stream).
+
+		template <class T, class TOperator, class TStream, class = void>
+		struct HasStreamAccumulator : std::false_type {};
+		template <class T, class TOperator, class TStream>
+		struct HasStreamAccumulator<T, TOperator, TStream, std::void_t<
+			decltype(std::declval<TOperator const &>().template initAccumulator<T>(std::declval<TStream&>()))> >
+			: std::true_type
+		{};
+
+		template <class T, class TOperator, class TStream>
+		constexpr auto initAccumulatorFor(TOperator const & operation, TStream & stream) {
+			if constexpr (HasStreamAccumulator<T, TOperator, TStream>::value)
+				return operation.template initAccumulator<T>(stream);
+			else
+				return operation.template initAccumulator<T>();
+		}
+
+		template <class TStream, class TOperator>
+		constexpr auto applyByAccumulating(TOperator const & operation, TStream & stream)
+			-> typename TOperator::template RetType<typename TStream::ResultValueType>
+		{
+			using T = typename TStream::ResultValueType;
+
+			auto accumulator = initAccumulatorFor<T>(operation, stream);
+			while (stream.hasNext())
+				operation.template accumulate<T>(accumulator, stream.nextElem());
+			return operation.template finish<T>(accumulator);
+		}
+
+		//---------------Memory resource--------------//
+
+		// INFO: if stream has memory resource (set by with_resource) then allocating operators
+		//		 replace their containers by std::pmr ones (ContainerFor)
+		//		 and construct them by resource of stream (makeContainer).
+
+		template <class TContainer>
+		struct PmrContainer {
+			using type = TContainer;
+		};
+		template <class T, class Allocator>
+		struct PmrContainer<std::vector<T, Allocator> > {
+			using type = std::pmr::vector<T>;
+		};
+		template <class CharT, class Traits, class Allocator>
+		struct PmrContainer<std::basic_string<CharT, Traits, Allocator> > {
+			using type = std::pmr::basic_string<CharT, Traits>;
+		};
+		template <class T, class Hash, class KeyEqual, class Allocator>
+		struct PmrContainer<std::unordered_set<T, Hash, KeyEqual, Allocator> > {
+			using type = std::pmr::unordered_set<T, Hash, KeyEqual>;
+		};
+
+		template <class TStream, class TContainer>
+		using ContainerFor = lipaboy_lib::enable_if_else_t<std::remove_reference_t<TStream>::hasMemoryResource(),
+			typename PmrContainer<TContainer>::type, TContainer>;
+
+		template <class TContainer, class = void>
+		struct IsPolymorphicAllocated : std::false_type {};
+		template <class TContainer>
+		struct IsPolymorphicAllocated<TContainer, std::void_t<typename TContainer::allocator_type> >
+			: std::is_same<typename TContainer::allocator_type,
+				std::pmr::polymorphic_allocator<typename TContainer::value_type> >
+		{};
+
+		template <class TContainer, class TSubStream>
+		TContainer makeContainer(TSubStream& stream) {
+			if constexpr (IsPolymorphicAllocated<TContainer>::value)
+				return TContainer(stream.memoryResource());
+			else
+				return TContainer();
+		}
+
+		// Info: allocator of own containers of operator (its state and buffers):
+		//		 polymorphic allocator if stream has memory resource, std::allocator otherwise.
+		template <class TStream, class T>
+		using AllocatorFor = typename ContainerFor<TStream, std::vector<T> >::allocator_type;
+
+		template <class Allocator, class T>
+		using RebindAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+		template <class Allocator, class TSubStream>
+		Allocator makeAllocator(TSubStream& stream) {
+			if constexpr (std::is_same_v<Allocator, std::pmr::polymorphic_allocator<typename Allocator::value_type> >)
+				return Allocator(stream.memoryResource());
+			else
+				return Allocator();
+		}
+
+		// Info: container of operator that must be allocated by resource of stream.
+		//		 It is created at the first request of element (when the stream is known)
+		//		 because operator is created and copied before it (while the stream is being extended).
+		//		 Copy keeps the allocator (copy constructor of pmr container takes the default resource).
+		template <class TContainer>
+		class LazyContainer {
+		public:
+			LazyContainer() = default;
+			LazyContainer(LazyContainer const & other) { copyFrom(other); }
+			LazyContainer(LazyContainer&&) = default;
+
+			LazyContainer& operator=(LazyContainer const & other) {
+				if (this != &other) {
+					container_.reset();
+					copyFrom(other);
+				}
+				return *this;
+			}
+			LazyContainer& operator=(LazyContainer&& other) {
+				container_.reset();
+				if (other.container_.has_value())
+					container_.emplace(std::move(*other.container_));
+				return *this;
+			}
+
+			template <class TSubStream>
+			TContainer & get(TSubStream& stream) {
+				if (!container_.has_value())
+					container_.emplace(makeContainer<TContainer>(stream));
+				return *container_;
+			}
+
+			bool isCreated() const { return container_.has_value(); }
+			TContainer & operator*() { return *container_; }
+			TContainer const & operator*() const { return *container_; }
+			TContainer * operator->() { return &(*container_); }
+			TContainer const * operator->() const { return &(*container_); }
+
+		private:
+			void copyFrom(LazyContainer const & other) {
+				if (other.container_.has_value())
+					container_.emplace(*other.container_, other.container_->get_allocator());
+			}
+
+		private:
+			std::optional<TContainer> container_;
+		};
+
 	}
 
 
@@ -107,8 +276,26 @@ namespace lipaboy_lib::stream_space {
 				template ExtendedStreamType<std::remove_reference_t<TOperator> >;
 		};
 
+		//---------------StreamTypeRewriter---------------//
+
+		// INFO: rewrite step between stream and its extender. By default it only extends
+		//		 the stream by one more level. Specializations can fuse the new operator
+		//		 with the last one of stream (see "stream/operators/fusion.h") to
+		//		 reduce the depth of StreamBase nesting.
+
+		template <class TStream, class TOperator>
+		struct StreamTypeRewriter {
+			using type = typename StreamTypeExtender<TStream, TOperator>::type;
+
+			template <class TOperator_, class TStream_>
+			static constexpr type extend(TOperator_&& operation, TStream_&& stream) {
+				return type(std::forward<TOperator_>(operation), std::forward<TStream_>(stream));
+			}
+		};
+
 		template <class TStream, class TOperator>
-		using StreamTypeExtender_t = typename StreamTypeExtender<TStream, TOperator>::type;
+		using StreamTypeExtender_t = typename StreamTypeRewriter<
+			std::remove_reference_t<TStream>, std::remove_reference_t<TOperator> >::type;
 
 		template <class TStream, class TOperator>
 		struct TerminatedOperatorTypeApply {
@@ -119,6 +306,26 @@ namespace lipaboy_lib::stream_space {
 		using TerminatedOperatorTypeApply_t =
 			typename TerminatedOperatorTypeApply<TStream, TOperator>::type;
 
+		// Info: source iterator can declare that it gives infinite sequence
+		//		 by static constexpr method isInfinite() (see "stream/operators/cache.h").
+		template <class TIterator, class = void>
+		struct IsInfiniteIterator : std::false_type {};
+		template <class TIterator>
+		struct IsInfiniteIterator<TIterator, std::void_t<decltype(TIterator::isInfinite())> >
+			: std::bool_constant<TIterator::isInfinite()>
+		{};
+
+		// Info: source iterator can declare that copies of it are cheap and replay the same elements
+		//		 by static constexpr method isReplayable() (see "stream/operators/cache.h").
+		//		 Terminated operator applied to l-value stream of such source works on its copy
+		//		 (also if the source is followed by stateless operators only, see StatelessOperator).
+		template <class TIterator, class = void>
+		struct IsReplayableIterator : std::false_type {};
+		template <class TIterator>
+		struct IsReplayableIterator<TIterator, std::void_t<decltype(TIterator::isReplayable())> >
+			: std::bool_constant<TIterator::isReplayable()>
+		{};
+
 		//------------------------------------------------------------------//
 		//-------------------------Useful aliases---------------------------//
 		//------------------------------------------------------------------//
@@ -135,10 +342,8 @@ namespace lipaboy_lib::stream_space {
 		constexpr size_t GetArgumentCount = function_traits<
 			lipaboy_lib::WrapBySTDFunctionType<TFunction> >::nargs;
 
-		// TODO: replace on std::false_type
-		using FalseType =
-			//std::false_type;
-			std::function<void(void)>;
+		// Info: empty literal tag (not invocable, unlike std::false_type and std::function)
+		struct FalseType {};
 
 		//
 
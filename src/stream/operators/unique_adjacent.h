@@ -0,0 +1,121 @@
+#pragma once
+
+#include "tools.h"
+
+#include <optional>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) unique_adjacent(eq) removes the elements which are equal to the previous kept element
+		//		(like std::unique), so the first element of every run of equal elements goes out.
+		//		eq(kept, elem) is called with the kept element as the first argument.
+		//	2) Only one element is stored: the first element of next run (lookahead). It is stored inline
+		//		(without allocation), elements are moved out of it.
+		//	3) The rest of run is skipped when its first element is requested, so elements are
+		//		pulled from sub-stream ahead (until the first element of next run).
+		//	4) It doesn't need memory for the whole stream (unlike distinct), but the stream must be
+		//		sorted or clustered to remove all the duplicates.
+
+		// Info: the base for operators which process the runs of equal adjacent elements
+		//		 (see "stream/operators/run_length.h" too).
+		template <class Equal, class T>
+		struct AdjacentRunsHolder : FunctorHolder<Equal>
+		{
+		public:
+			using size_type = size_t;
+
+		public:
+			AdjacentRunsHolder(Equal eq) : FunctorHolder<Equal>(eq) {}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				prime(stream);
+				return lookahead_.has_value();
+			}
+
+		protected:
+			// Info: takes the next run away and returns its first element and length
+			template <class TSubStream>
+			std::pair<T, size_type> takeRun(TSubStream& stream) {
+				prime(stream);
+				std::pair<T, size_type> run(std::move(*lookahead_), 1);
+				lookahead_.reset();
+				auto eq = this->functor();
+				while (stream.hasNext()) {
+					T elem = stream.nextElem();
+					if (!eq(run.first, elem)) {
+						lookahead_.emplace(std::move(elem));
+						break;
+					}
+					run.second++;
+				}
+				return run;
+			}
+
+		private:
+			template <class TSubStream>
+			void prime(TSubStream& stream) {
+				if (isPrimed_)
+					return;
+				isPrimed_ = true;
+				if (stream.hasNext())
+					lookahead_.emplace(stream.nextElem());
+			}
+
+		private:
+			std::optional<T> lookahead_;
+			bool isPrimed_ = false;
+		};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class Equal = std::equal_to<> >
+		struct unique_adjacent : FunctorHolder<Equal>, TReturnSameType
+		{
+		public:
+			unique_adjacent(Equal eq = Equal()) : FunctorHolder<Equal>(eq) {}
+		};
+
+		template <class Equal, class T>
+		struct unique_adjacent_impl : AdjacentRunsHolder<Equal, T>, TReturnSameType
+		{
+		public:
+			using Base = AdjacentRunsHolder<Equal, T>;
+
+		public:
+			unique_adjacent_impl(unique_adjacent<Equal> const & obj) : Base(obj.functor()) {}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> T {
+				return std::move(Base::takeRun(stream).first);
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				Base::takeRun(stream);
+			}
+		};
+
+	}
+
+	using operators::unique_adjacent;
+	using operators::unique_adjacent_impl;
+
+	template <class TStream, class Equal>
+	struct shortening::StreamTypeExtender<TStream, unique_adjacent<Equal> > {
+		template <class T>
+		using remref = std::remove_reference_t<T>;
+
+		using type = typename remref<TStream>::template ExtendedStreamType<
+			unique_adjacent_impl<Equal, typename remref<TStream>::ResultValueType> >;
+	};
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "tools.h"
+
+#include <memory_resource>
+#include <stdexcept>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) Elements are passed through without changes.
+		//	2) Allocating operators after with_resource allocate by the resource:
+		//		split, group_by_vector, group_by_span, distinct, filter, drop_while, take_while, join_on,
+		//		parallel_map, cache, reverse, sorted_radix (their buffers and state),
+		//		to_vector, partition_to, sample, stats (their results - also inside multi).
+		//		Returned containers become std::pmr ones (e.g. group_by_vector gives std::pmr::vector).
+		//		All of them allocate by the consuming thread only, so the resource needn't be thread-safe.
+		//	3) The resource must outlive the stream and everything that is allocated by it.
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		struct with_resource : TReturnSameType, ResourceHolderOperator, StatelessOperator
+		{
+		public:
+			with_resource(std::pmr::memory_resource* resource) : pResource_(resource) {
+				if (resource == nullptr)
+					throw std::logic_error("Parameter of with_resource must be not null");
+			}
+
+			template <class TSubStream>
+			constexpr auto nextElem(TSubStream& stream) -> typename TSubStream::ResultValueType {
+				return stream.nextElem();
+			}
+
+			template <class TSubStream>
+			constexpr void incrementSlider(TSubStream& stream) { stream.incrementSlider(); }
+
+			template <class TSubStream>
+			constexpr bool hasNext(TSubStream& stream) { return stream.hasNext(); }
+
+			std::pmr::memory_resource* resource() const { return pResource_; }
+
+		private:
+			std::pmr::memory_resource* pResource_;
+		};
+
+	}
+
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "tools.h"
+
+#include <tuple>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	namespace operators {
+
+		// Contract rules :
+		//	1) zip(s1, s2, ..., sN) gives tuples (e1, e2, ..., eN) while all the streams have elements.
+		//		If stream's elements are references then tuple keeps references.
+		//	2) Elements are moved into tuple directly (in order of streams), without intermediate pairs.
+		//	3) Skipping of tuple (incrementSlider) skips elements of all the streams without materializing.
+		//	4) Zipped stream is finite if at least one of the streams is finite.
+		//	5) Zipped stream is random access if all the streams are random access sources.
+		//		Then its size is the minimal size of them and it is skipped in O(1) (e.g. by skip, nth, count).
+
+		struct UnboundedZipTag {};
+
+		//-------------------------------------------------------------------------------------//
+		//--------------------------------Unterminated operation------------------------------//
+		//-------------------------------------------------------------------------------------//
+
+		template <class... TStreams>
+		struct zipped
+			: std::conditional_t<(... || !TStreams::isInfinite()), FixSizeOperator, UnboundedZipTag>,
+			RandomAccessOperator
+		{
+		public:
+			using size_type = size_t;
+			using StreamsType = std::tuple<TStreams...>;
+			using IndicesType = std::index_sequence_for<TStreams...>;
+
+			template <class T>
+			using RetType = std::tuple<T, typename TStreams::ResultValueType...>;
+
+		public:
+			zipped(TStreams... streams)
+				: streams_(std::move(streams)...)
+			{}
+
+			template <class TSubStream>
+			auto nextElem(TSubStream& stream) -> RetType<typename TSubStream::ResultValueType> {
+				return nextElem(stream, IndicesType());
+			}
+
+			template <class TSubStream>
+			void incrementSlider(TSubStream& stream) {
+				stream.incrementSlider();
+				std::apply([](auto&... others) { (others.incrementSlider(), ...); }, streams_);
+			}
+
+			template <class TSubStream>
+			bool hasNext(TSubStream& stream) {
+				return stream.hasNext()
+					&& std::apply([](auto&... others) { return (... && others.hasNext()); }, streams_);
+			}
+
+			//-----------------Random access API--------------//
+
+			template <class TSubStream>
+			static constexpr bool isRandomAccess() {
+				return TSubStream::isRandomAccess() && (... && TStreams::isRandomAccess());
+			}
+
+			template <class TSubStream>
+			size_type restSize(TSubStream const & stream) const {
+				return std::apply([&stream](auto const &... others) {
+						return std::min({ stream.restSize(), others.restSize()... });
+					}, streams_);
+			}
+
+			template <class TSubStream>
+			void advanceSlider(TSubStream& stream, size_type count) {
+				stream.advanceSlider(count);
+				std::apply([count](auto&... others) { (others.advanceSlider(count), ...); }, streams_);
+			}
+
+		private:
+			template <class TSubStream, size_t... I>
+			auto nextElem(TSubStream& stream, std::index_sequence<I...>)
+				-> RetType<typename TSubStream::ResultValueType>
+			{
+				// Info: braced initialization guarantees order of evaluation
+				return RetType<typename TSubStream::ResultValueType>{
+					stream.nextElem(), std::get<I>(streams_).nextElem()... };
+			}
+
+		private:
+			StreamsType streams_;
+		};
+
+	}
+
+	using operators::zipped;
+
+	template <class TFirstStream, class... TStreams>
+	auto zip(TFirstStream&& first, TStreams&&... streams)
+	{
+		return std::forward<TFirstStream>(first)
+			| zipped<std::decay_t<TStreams>...>(std::forward<TStreams>(streams)...);
+	}
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "light_stream.h"
+#include "extra_tools/range_iterator.h"
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace lipaboy_lib::stream_space {
+
+	// INFO: sources of arithmetic progressions: range(first, last, step) gives
+	//		 first, first + step, ... while elements are less than last (greater for negative step).
+	//		 iota(n) gives 0, 1, ..., n - 1.
+	//		 Such streams know their size and are skipped in O(1) (by skip, nth and count).
+	//		 Example: range(1, 100, 2) | map(square) | sum()
+
+	using lipaboy_lib::RangeIterator;
+
+	template <class T>
+	using StreamOfRange = StreamOfOutsideIterators<RangeIterator<T> >;
+
+	template <class T>
+	constexpr auto range(T first, T last, T step = T(1))
+		-> StreamOfRange<T>
+	{
+		static_assert(std::is_arithmetic_v<T>, "Stream error: range of non-arithmetic type");
+		if (step == T(0))
+			throw std::logic_error("Parameter of range (step) must be not zero");
+
+		using difference_type = typename RangeIterator<T>::difference_type;
+		difference_type size = 0;
+		if ((step > T(0) && first < last) || (step < T(0) && last < first)) {
+			if constexpr (std::is_integral_v<T>) {
+				// Info: distance of wide signed range doesn't fit into T
+				using Unsigned = std::make_unsigned_t<T>;
+				const Unsigned distance = (step > T(0))
+					? Unsigned(Unsigned(last) - Unsigned(first)) : Unsigned(Unsigned(first) - Unsigned(last));
+				const Unsigned stride = (step > T(0)) ? Unsigned(step) : Unsigned(Unsigned(0) - Unsigned(step));
+				size = static_cast<difference_type>(distance / stride + ((distance % stride != 0) ? 1 : 0));
+			}
+			else {
+				auto ratio = (last - first) / step;
+				size = static_cast<difference_type>(ratio);
+				size += (static_cast<T>(size) < ratio) ? 1 : 0;
+			}
+		}
+		return StreamOfRange<T>(RangeIterator<T>(first, step), RangeIterator<T>(first, step, size));
+	}
+
+	template <class T>
+	constexpr auto iota(T count)
+		-> StreamOfRange<T>
+	{
+		return range<T>(T(0), count);
+	}
+
+	// Info: splits the rest of random access source into 'parts' streams of almost equal sizes
+	//		 (e.g. for processing by different threads). Elements are not copied.
+	//		 First (size % parts) streams are longer by one element.
+	template <class TStream>
+	auto splitIntoParts(TStream const & stream, size_t parts)
+		-> std::vector<TStream>
+	{
+		using TIterator = typename TStream::outside_iterator;
+		// Info: extended streams are derived from their sources, so they must be rejected explicitly
+		static_assert(std::is_same_v<TStream, StreamBase<TIterator> > && TStream::isRandomAccess(),
+			"Stream error: only random access source can be split");
+		if (parts == 0)
+			throw std::logic_error("Parameter of splitIntoParts (parts) must be positive");
+
+		using difference_type = typename std::iterator_traits<TIterator>::difference_type;
+		const size_t size = stream.restSize();
+		// Info: boundaries are computed without product size * i (it overflows for wide ranges)
+		const size_t partSize = size / parts;
+		const size_t remainder = size % parts;
+		auto boundary = [&](size_t i) {
+			return stream.sourceBegin() + static_cast<difference_type>(partSize * i + std::min(i, remainder));
+		};
+		std::vector<TStream> result;
+		result.reserve(parts);
+		for (size_t i = 0; i < parts; i++)
+			result.emplace_back(boundary(i), boundary(i + 1));
+		return result;
+	}
+
+}
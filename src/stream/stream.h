@@ -1,3 +1,5 @@
 
 #include "operators/operators.h"
 #include "light_stream.h"
+#include "range.h"
+#include "any_stream.h"
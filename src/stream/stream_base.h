@@ -7,12 +7,27 @@
 #include <functional>
 #include <iterator>
 #include <type_traits>
+#include <memory_resource>
 
 namespace lipaboy_lib::stream_space {
 
 	using lipaboy_lib::ProducingIterator;
 	using lipaboy_lib::InitializerListIterator;
 
+	namespace shortening {
+
+		// Info: source can be bounded by sentinel of other type (see "extra_tools/array_iterator.h")
+		template <class TIterator, class = void>
+		struct SentinelOf {
+			using type = TIterator;
+		};
+		template <class TIterator>
+		struct SentinelOf<TIterator, std::void_t<typename TIterator::sentinel_type> > {
+			using type = typename TIterator::sentinel_type;
+		};
+
+	}
+
 	//--------------------------Stream Base (specialization class)----------------------//
 
 	template <class TIterator>
@@ -22,6 +37,7 @@ namespace lipaboy_lib::stream_space {
 		using ValueType = T;
 		using size_type = size_t;
 		using outside_iterator = TIterator;
+		using sentinel_type = typename shortening::SentinelOf<TIterator>::type;
 		using GeneratorTypePtr = std::function<ValueType(void)>;
 
 	public:
@@ -38,11 +54,11 @@ namespace lipaboy_lib::stream_space {
 	public:
 		//----------------------Constructors----------------------//
 
-		template <class OuterIterator>
-		explicit
-			StreamBase(OuterIterator begin, OuterIterator end)
-				: begin_(begin),
-				end_(end)
+		template <class OuterIterator, class OuterSentinel>
+		constexpr explicit
+			StreamBase(OuterIterator begin, OuterSentinel end)
+				: begin_(std::move(begin)),
+				end_(std::move(end))
 		{}
 		explicit
 			StreamBase(std::initializer_list<T> init)
@@ -62,7 +78,8 @@ namespace lipaboy_lib::stream_space {
 	protected:
 		static constexpr bool isNoFixSizeOperatorBefore() { return true; }
 		static constexpr bool isGeneratorProducing() {
-			return std::is_same_v<TIterator, ProducingIterator<ValueType> >;
+			return std::is_same_v<TIterator, ProducingIterator<ValueType> >
+				|| shortening::IsInfiniteIterator<TIterator>::value;
 		}
 		static constexpr bool isInitializingListCreation() {
 			return std::is_same_v<TIterator, InitializerListIterator<ValueType>
@@ -83,6 +100,10 @@ namespace lipaboy_lib::stream_space {
 				"Stream error: attempt to work with infinite stream");
 		}
 
+		// Info: memory resource is set by with_resource operator only
+		static constexpr bool hasMemoryResource() { return false; }
+		std::pmr::memory_resource* memoryResource() const { return std::pmr::get_default_resource(); }
+
 	protected:
 		// Info:
 		// illusion of protected (it means that can be replace on private)
@@ -92,18 +113,38 @@ namespace lipaboy_lib::stream_space {
 
 		//-----------------Slider API--------------//
 	public:
-		ResultValueType nextElem() {
+		constexpr ResultValueType nextElem() {
 			auto elem = //std::forward<T>(
 				*begin_;
 				//);
-			begin_++;
+			++begin_;
 			return elem;
 		}
-		bool hasNext() { return begin_ != end_; }
-		void incrementSlider() { begin_++; }
+		constexpr bool hasNext() { return begin_ != end_; }
+		constexpr void incrementSlider() { ++begin_; }
 
 		//-----------------Slider API Ends--------------//
 
+		// Info: random access sources are skipped and measured in O(1)
+		//		 (see skip, nth, count and "stream/range.h").
+		static constexpr bool isRandomAccess() {
+			return std::is_base_of_v<std::random_access_iterator_tag,
+				typename std::iterator_traits<TIterator>::iterator_category>;
+		}
+		constexpr size_type restSize() const {
+			static_assert(isRandomAccess(), "Stream error: size of source is unknown");
+			return static_cast<size_type>(end_ - begin_);
+		}
+		constexpr void advanceSlider(size_type count) {
+			static_assert(isRandomAccess(), "Stream error: source can't be advanced");
+			begin_ += static_cast<typename std::iterator_traits<TIterator>::difference_type>(
+				(count < restSize()) ? count : restSize());
+		}
+
+		// Info: rest of the source (see "stream/operators/reverse.h")
+		constexpr TIterator const & sourceBegin() const { return begin_; }
+		constexpr sentinel_type const & sourceEnd() const { return end_; }
+
 	public:
 		bool operator==(StreamBase const & other) const { return equals(other); }
 		bool operator!=(StreamBase const & other) const { return !((*this) == other); }
@@ -115,7 +156,7 @@ namespace lipaboy_lib::stream_space {
 
 	private:
 		TIterator begin_;
-		TIterator end_;
+		sentinel_type end_;
 	};
 
 }
@@ -3,6 +3,7 @@
 #include <functional>
 #include <iterator>
 #include <type_traits>
+#include <memory_resource>
 
 #ifdef DEBUG_STREAM_WITH_NOISY
 #include <iostream>
@@ -37,7 +38,7 @@ namespace lipaboy_lib::stream_space {
 	public:
 
 		template <class StreamSubType_, class TFunctor_>
-		explicit
+		constexpr explicit
 			StreamBase(TFunctor_&& functor, StreamSubType_&& obj) noexcept
 			: SubType(std::forward<StreamSubType_>(obj)), operator_(std::forward<TFunctor_>(functor))
 		{
@@ -49,7 +50,7 @@ namespace lipaboy_lib::stream_space {
 #endif
 		}
 	public:
-		StreamBase(StreamBase const & obj)
+		constexpr StreamBase(StreamBase const & obj)
 			: SubType(static_cast<ConstSubType&>(obj)),
 			operator_(obj.operator_)
 		{
@@ -57,7 +58,7 @@ namespace lipaboy_lib::stream_space {
 			std::cout << "   StreamEx copy-constructed" << std::endl;
 #endif
 		}
-		StreamBase(StreamBase&& obj) noexcept
+		constexpr StreamBase(StreamBase&& obj) noexcept
 			: SubType(std::move(obj)),
 			operator_(std::move(obj.operator_))
 		{
@@ -84,15 +85,37 @@ namespace lipaboy_lib::stream_space {
 		}
 		template <class TStream_>
 		inline static constexpr void assertOnInfinite() {
-			SubType::template assertOnInfinite<TStream_>();
+			StreamBase<outside_iterator>::template assertOnInfinite<TStream_>();
 		}
 
-	protected:
-		// shortnesses
-		SubTypePtr subThisPtr() { return static_cast<SubTypePtr>(this); }
-		ConstSubTypePtr constSubThisPtr() const { return static_cast<ConstSubTypePtr>(this); }
-		auto subNextElem() -> typename SubType::ResultValueType { return subThisPtr()->nextElem(); }
-		bool subHasNext() { return subThisPtr()->hasNext(); }
+		// Info: only sources (see "stream/stream_base.h") and streams extended by random access operators
+		//		 (see RandomAccessOperator) can be random access
+		static constexpr bool isRandomAccess() {
+			if constexpr (std::is_base_of_v<operators::RandomAccessOperator, TOperator>)
+				return TOperator::template isRandomAccess<SubType>();
+			else
+				return false;
+		}
+		constexpr size_type restSize() const {
+			static_assert(isRandomAccess(), "Stream error: size of stream is unknown");
+			return operator_.template restSize<SubType>(static_cast<ConstSubType&>(*this));
+		}
+		constexpr void advanceSlider(size_type count) {
+			static_assert(isRandomAccess(), "Stream error: stream can't be advanced");
+			operator_.template advanceSlider<SubType>(static_cast<SubType&>(*this), count);
+		}
+
+		static constexpr bool hasMemoryResource() {
+			return std::is_base_of_v<operators::ResourceHolderOperator, TOperator>
+				|| SubType::hasMemoryResource();
+		}
+		// Info: the nearest resource from the end of pipeline
+		std::pmr::memory_resource* memoryResource() const {
+			if constexpr (std::is_base_of_v<operators::ResourceHolderOperator, TOperator>)
+				return operator_.resource();
+			else
+				return SubType::memoryResource();
+		}
 
 		//------------------------------------------------------------------------//
 		//-----------------------------Slider API---------------------------------//
@@ -100,16 +123,16 @@ namespace lipaboy_lib::stream_space {
 
 	public:
 
-		ResultValueType nextElem() {
-            return operator_.template nextElem<SubType>(*subThisPtr());
+		constexpr ResultValueType nextElem() {
+			return operator_.template nextElem<SubType>(static_cast<SubType&>(*this));
 		}
 
-		bool hasNext() {
-            return operator_.template hasNext<SubType>(*subThisPtr());
+		constexpr bool hasNext() {
+			return operator_.template hasNext<SubType>(static_cast<SubType&>(*this));
 		}
 
-		void incrementSlider() {
-            operator_.template incrementSlider<SubType>(*subThisPtr());
+		constexpr void incrementSlider() {
+			operator_.template incrementSlider<SubType>(static_cast<SubType&>(*this));
 		}
 
 
@@ -122,12 +145,12 @@ namespace lipaboy_lib::stream_space {
 	private:
 		bool equals(StreamBase & other) {
 			return (operator_ == other.operator_
-				&& subThisPtr()->equals(static_cast<SubType&>(other))
+				&& static_cast<SubType&>(*this).equals(static_cast<SubType&>(other))
 				);
 		}
 
 	public:
-		TOperator const & operation() const { return operator_; }
+		constexpr TOperator const & operation() const { return operator_; }
 
 		//---------------------------------------------------//
 		//---------------------Fields------------------------//
@@ -56,6 +56,38 @@ namespace long_numbers_tests {
 		ASSERT_EQ(numRes, second.to_string(2));
 	}
 
+	TEST(LongUnsigned, to_string_hexadecimal_and_greater_bases) {
+		LongUnsigned<2> first(0);
+		first[1] = 0xabc;
+		first[0] = 0xdef01234;
+		ASSERT_EQ(first.to_string(16), "abcdef01234");
+		ASSERT_EQ(LongUnsigned<1>(1295).to_string(36), "zz");
+		ASSERT_EQ(LongUnsigned<1>(0).to_string(16), "0");
+
+		ASSERT_ANY_THROW(first.to_string(1));
+		ASSERT_ANY_THROW(first.to_string(37));
+	}
+
+	TEST(LongUnsigned, to_string_long_number) {
+		// it's converted by splitting into halves
+		LongUnsigned<64> first(1);
+		first.shiftLeft(2047);
+		LongUnsigned<64> second(1);
+		second.shiftLeft(1000);
+		first += second;
+		first += LongUnsigned<1>(7);
+
+		string str = first.to_string();
+		ASSERT_EQ(str.size(), 617);
+		ASSERT_EQ(str.substr(0, 40), "1615850303565550365035743834433497598022");
+		ASSERT_EQ(str.substr(617 - 40), "9201406962905905749402313642735466184711");
+
+		string hex = first.to_string(16);
+		ASSERT_EQ(hex.size(), 512);
+		ASSERT_EQ(hex.substr(0, 20), "80000000000000000000");
+		ASSERT_EQ(hex.back(), '7');
+	}
+
 	//-------------------------------------------------------------------//
 	//----------------------------assignStr()----------------------------//
 	//-------------------------------------------------------------------//
@@ -76,6 +108,41 @@ namespace long_numbers_tests {
 		}
 	}
 
+	TEST(LongUnsigned, assign_str_round_trip_in_all_bases) {
+		LongUnsigned<8> first(1);
+		first.shiftLeft(250);
+		first += LongUnsigned<2>("123456789012345678901");
+		LongUnsigned<8> second;
+		for (unsigned int base = 2; base <= 36; base++) {
+			string numStr = first.to_string(base);
+			second.assignStr(numStr, base);
+			ASSERT_EQ(first, second);
+			ASSERT_EQ(second.to_string(base), numStr);
+		}
+		ASSERT_EQ(LongUnsigned<1>("ZZ", 36), LongUnsigned<1>(1295));
+		ASSERT_EQ(LongUnsigned<1>("  ff", 16), LongUnsigned<1>(255));
+		ASSERT_ANY_THROW(second.assignStr("10", 37));
+	}
+
+	TEST(LongUnsigned, assign_str_overflow) {
+		ASSERT_EQ(LongUnsigned<1>("4294967295"), LongUnsigned<1>(4294967295u));
+		// number is taken modulo 2^32
+		ASSERT_EQ(LongUnsigned<1>("4294967296"), LongUnsigned<1>(0));
+		ASSERT_EQ(LongUnsigned<1>("789100000200"), LongUnsigned<1>(3120985032u));
+	}
+
+	TEST(LongUnsigned, assign_str_long_number) {
+		LongUnsigned<64> first(1);
+		first.shiftLeft(2047);
+		first += LongUnsigned<1>(12345);
+		string numStr = first.to_string();
+
+		LongUnsigned<64> second(numStr);
+		ASSERT_EQ(first, second);
+		second.assignStr("000" + numStr);
+		ASSERT_EQ(first, second);
+	}
+
 	//-----Any system------//
 
 	TEST(LongUnsigned, simple) {
@@ -298,6 +365,49 @@ namespace long_numbers_tests {
 		ASSERT_EQ(first.to_string(), "1");
 	}
 
+	TEST(LongUnsigned, division_multiword) {
+		LongUnsigned<8> first(1);
+		first.shiftLeft(200);
+		first += LongUnsigned<1>(12345);
+		LongUnsigned<8> second(1);
+		second.shiftLeft(70);
+		second += LongUnsigned<1>(3);
+
+		auto res = first.divide(second);
+		EXPECT_EQ(res.first.to_string(), "1361129467683753853850039665213252304896");
+		EXPECT_EQ(res.second.to_string(), "10376293541461635129");
+	}
+
+	TEST(LongUnsigned, division_with_correction_of_estimation) {
+		// estimated word of quotient is greater than true one by one, divider is added back
+		LongUnsigned<4> first(0);
+		first[3] = 0x7fffffff;
+		first[2] = 0x80000000;
+		first[1] = 0xffffffff;
+		first[0] = 3;
+		LongUnsigned<4> second(0);
+		second[2] = 0x80000000;
+		second[1] = 1;
+		second[0] = 1;
+
+		auto res = first.divide(second);
+		EXPECT_EQ(res.first, LongUnsigned<1>(0xfffffffe));
+		EXPECT_EQ(res.second[2], 0x80000000);
+		EXPECT_EQ(res.second[1], 0);
+		EXPECT_EQ(res.second[0], 5);
+	}
+
+	TEST(LongUnsigned, division_by_word) {
+		LongUnsigned<3> first(0);
+		first -= LongUnsigned<1>(1);
+
+		auto res = first.divide(7u);
+		EXPECT_EQ(res.first.to_string(), "11318308930609191084791992905");
+		EXPECT_EQ(res.second, 0);
+		EXPECT_EQ((first / LongUnsigned<3>(7)).to_string(), "11318308930609191084791992905");
+		EXPECT_EQ((first % LongUnsigned<3>(10)).to_string(), "5");
+	}
+
     //---------Operator% checking-----------//
 
     TEST(LongUnsigned, remainder_double) {
@@ -442,6 +552,18 @@ namespace long_numbers_tests {
     }
 
 
+	TEST(LongUnsigned, multiplication_with_carries) {
+		LongUnsigned<4> first(0);
+		first[0] = 0xffffffff;
+		first[1] = 0xffffffff;
+
+		auto res = first * first;
+		EXPECT_EQ(res[3], 0xffffffff);
+		EXPECT_EQ(res[2], 0xfffffffe);
+		EXPECT_EQ(res[1], 0);
+		EXPECT_EQ(res[0], 1);
+	}
+
     TEST(LongUnsigned, sum_double_rank_by_crossing_parts) {
         LongUnsigned<2> num1("789100000200");
         LongUnsigned<2> num2("111901000001");
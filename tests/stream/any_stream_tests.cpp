@@ -0,0 +1,106 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	namespace {
+		AnyStream<int> oddSquares(vector<int> const & vec) {
+			return Stream(vec)
+				| filter([](int a) { return a % 2 == 1; })
+				| map([](int a) { return a * a; });
+		}
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_AnyStream, returned_from_function) {
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+		ASSERT_EQ(oddSquares(vec) | to_vector(), vector<int>({ 1, 9, 25 }));
+		ASSERT_EQ(oddSquares(vec) | map([](int a) { return a + 1; }) | sum(), 38);
+	}
+
+	TEST(Stream_AnyStream, heterogeneous_container) {
+		vector<int> vec = { 1, 2, 3, 4, 5, 6, 7 };
+		vector<AnyStream<int> > streams;
+		streams.emplace_back(Stream(vec));
+		streams.emplace_back(range(0, 1000) | get(3));
+		streams.emplace_back(Stream(vec) | skip(5), 1);
+
+		vector<size_t> counts;
+		for (auto & stream : streams)
+			counts.push_back(stream | count());
+		ASSERT_EQ(counts, vector<size_t>({ 7, 3, 2 }));
+	}
+
+	TEST(Stream_AnyStream, batches_and_copies) {
+		int calls = 0;
+		auto erased = CopyableAnyStream<int>(iota(10) | map([&calls](int a) { calls++; return a; }), 4);
+
+		// the first batch only
+		auto first = erased | nth(0);
+		EXPECT_EQ(first, std::optional<int>(0));
+		EXPECT_EQ(calls, 4);
+
+		// copy has its own pipeline and buffer (from the current position)
+		auto copy = erased;
+		ASSERT_EQ(copy | to_vector(), vector<int>({ 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+		ASSERT_EQ(erased | skip(7) | to_vector(), vector<int>({ 8, 9 }));
+	}
+
+	TEST(Stream_AnyStream, copyability) {
+		static_assert(!std::is_copy_constructible_v<AnyStream<int> >);
+		static_assert(std::is_move_constructible_v<AnyStream<int> >);
+		static_assert(std::is_copy_constructible_v<CopyableAnyStream<int> >);
+
+		// elements that aren't default constructible are appended to the buffer
+		struct Wrapper {
+			explicit Wrapper(int val) : val(val) {}
+			int val;
+		};
+		CopyableAnyStream<Wrapper> erased(range(0, 5) | map([](int a) { return Wrapper(a); }), 2);
+		auto copy = erased;
+		auto res = std::move(copy) | map([](Wrapper w) { return w.val; }) | to_vector();
+		ASSERT_EQ(res, vector<int>({ 0, 1, 2, 3, 4 }));
+		ASSERT_EQ(erased | count(), 5u);
+	}
+
+	TEST(Stream_AnyStream, move_only_elements) {
+		AnyStream<std::unique_ptr<int> > erased = iota(5)
+			| map([](int a) { return std::make_unique<int>(a); });
+
+		auto res = std::move(erased)
+			| map([](std::unique_ptr<int> ptr) { return *ptr; })
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 0, 1, 2, 3, 4 }));
+		ASSERT_ANY_THROW(AnyStream<int>(iota(5), 0));
+	}
+
+	TEST(Stream_AnyStream, random_access_batches) {
+		vector<int> vec = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		int calls = 0;
+		AnyStream<int> erased(Stream(vec) | map([&calls](int a) { calls++; return a * 2; }), 4);
+
+		ASSERT_EQ(erased | nth(1), std::optional<int>(2));
+		EXPECT_EQ(calls, 4);
+		// the last batch is partial
+		ASSERT_EQ(std::move(erased) | to_vector(), vector<int>({ 4, 6, 8, 10, 12, 14, 16, 18 }));
+		EXPECT_EQ(calls, 10);
+	}
+
+}
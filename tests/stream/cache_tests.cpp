@@ -0,0 +1,133 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Cache, replay_without_recomputation) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+		auto cached = Stream(vec)
+			| map([&calls](int a) { calls++; return a * a; })
+			| cache();
+
+		auto sumOfSquares = cached | map([](int a) { return a; }) | sum();
+		EXPECT_EQ(sumOfSquares, 55);
+		EXPECT_EQ(calls, 5);
+
+		auto copy = cached;
+		auto maximum = copy | max();
+		EXPECT_EQ(maximum, std::optional<int>(25));
+
+		auto squares = cached | to_vector();
+		ASSERT_EQ(squares, vector<int>({ 1, 4, 9, 16, 25 }));
+		ASSERT_EQ(calls, 5);
+	}
+
+	TEST(Stream_Cache, several_terminals_on_same_stream) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+		auto cached = Stream(vec)
+			| map([&calls](int a) { calls++; return a * 2; })
+			| cache();
+
+		ASSERT_EQ(cached | sum(), 30);
+		ASSERT_EQ(cached | count(), 5u);
+		ASSERT_EQ(cached | to_vector(), vector<int>({ 2, 4, 6, 8, 10 }));
+		ASSERT_EQ(calls, 5);
+
+		// terminal goes on from the position of stream but doesn't move it
+		ASSERT_EQ(cached.nextElem(), 2);
+		ASSERT_EQ(cached | count(), 4u);
+		ASSERT_EQ(cached | count(), 4u);
+	}
+
+	TEST(Stream_Cache, terminals_after_stateless_operators) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4 };
+		auto cached = Stream(vec)
+			| map([&calls](int a) { calls++; return a; })
+			| cache();
+
+		// map has no state of pulling, so the stream is still replayable
+		auto mapped = cached | map([](int a) { return a * 3; }) | cast_static<double>();
+		ASSERT_EQ(mapped | sum(), 30.);
+		ASSERT_EQ(mapped | to_vector(), vector<double>({ 3., 6., 9., 12. }));
+		// buffered elements are replayed, only the outer map is applied again
+		ASSERT_EQ(calls, 4);
+
+		// filter holds the state of pulling: l-value stream with it is consumed by terminal
+		auto filtered = cached | filter([](int a) { return a % 2 == 0; });
+		ASSERT_EQ(filtered | count(), 2u);
+		ASSERT_EQ(filtered | count(), 0u);
+		// but the cached stream itself is still untouched
+		ASSERT_EQ(cached | count(), 4u);
+	}
+
+	TEST(Stream_Cache, copy_of_consumed_part) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+		auto cached = Stream(vec)
+			| map([&calls](int a) { calls++; return a * 10; })
+			| cache();
+		auto fromBeginning = cached;
+
+		ASSERT_EQ(cached.nextElem(), 10);
+		ASSERT_EQ(cached.nextElem(), 20);
+
+		// copy goes on from the copied position
+		auto copy = cached;
+		ASSERT_EQ(copy | to_vector(), vector<int>({ 30, 40, 50 }));
+		ASSERT_EQ(cached | to_vector(), vector<int>({ 30, 40, 50 }));
+		ASSERT_EQ(fromBeginning | to_vector(), vector<int>({ 10, 20, 30, 40, 50 }));
+		ASSERT_EQ(calls, 5);
+	}
+
+	TEST(Stream_Cache, lazy_pulling) {
+		int calls = 0;
+		vector<string> vec = { "a", "b", "c", "d" };
+		auto cached = Stream(vec)
+			| map([&calls](string const & str) { calls++; return str + str; })
+			| cache();
+
+		auto first = cached | get(2) | to_vector();
+		EXPECT_EQ(first, vector<string>({ "aa", "bb" }));
+		EXPECT_EQ(calls, 2);
+
+		// skipped elements are cached too
+		auto last = cached | skip(3) | nth(0);
+		EXPECT_EQ(last, std::optional<string>("dd"));
+		ASSERT_EQ(calls, 4);
+	}
+
+	TEST(Stream_Cache, infinite_generator) {
+		int a = 0;
+		auto cached = Stream([&a]() { return a++; }) | cache();
+		static_assert(decltype(cached)::isInfinite());
+
+		auto firstSum = cached | get(10) | sum();
+		auto secondSum = cached | get(10) | sum();
+		ASSERT_EQ(firstSum, 45);
+		ASSERT_EQ(secondSum, 45);
+		// generator produces one element ahead
+		ASSERT_EQ(a, 11);
+	}
+
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <array>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+	using std::array;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Constexpr, map_filter_sum) {
+		constexpr auto res = Stream(1, 2, 3, 4, 5)
+			| map([](int a) { return a * a; })
+			| filter([](int a) { return a % 2 == 1; })
+			| sum();
+		static_assert(res == 1 + 9 + 25);
+		ASSERT_EQ(res, 35);
+	}
+
+	TEST(Stream_Constexpr, get_skip_reduce) {
+		constexpr auto res = Stream(1, 2, 3, 4, 5, 6, 7)
+			| skip(1)
+			| get(4)
+			| reduce([](int first, int second) { return first * second; });
+		static_assert(res == 2 * 3 * 4 * 5);
+		ASSERT_EQ(res, 120);
+	}
+
+	TEST(Stream_Constexpr, to_array) {
+		constexpr auto res = Stream(1, 2, 3, 4)
+			| map([](int a) { return a * 10; })
+			| to_array<4>();
+		static_assert(res[0] == 10 && res[1] == 20 && res[2] == 30 && res[3] == 40);
+		ASSERT_EQ(res, (array<int, 4>({ 10, 20, 30, 40 })));
+
+		constexpr auto partial = Stream(1, 2, 3, 4)
+			| filter([](int a) { return a > 2; })
+			| to_array<3>();
+		static_assert(partial[0] == 3 && partial[1] == 4 && partial[2] == 0);
+
+		ASSERT_THROW(Stream(1, 2, 3) | to_array<2>(), std::length_error);
+	}
+
+	namespace {
+		struct Point {
+			constexpr Point(int x, int y) : x(x), y(y) {}
+			int x;
+			int y;
+		};
+	}
+
+	TEST(Stream_Constexpr, elements_are_stored_once) {
+		// end of source is sentinel without elements
+		using StreamType = decltype(Stream(1, 2, 3, 4));
+		static_assert(sizeof(StreamType) <= sizeof(ArrayIterator<int, 4>) + sizeof(size_t));
+
+		// elements needn't be default constructible
+		constexpr auto res = Stream(Point(1, 2), Point(3, 4), Point(5, 6))
+			| map([](Point p) { return p.x * p.y; })
+			| sum();
+		static_assert(res == 44);
+		ASSERT_EQ(res, 44);
+	}
+
+	TEST(Stream_Constexpr, equality_of_literals) {
+		static_assert(ArrayIterator<int, 3>({ 1, 2, 3 }) == ArrayIterator<int, 3>({ 1, 2, 3 }));
+		static_assert(ArrayIterator<int, 3>({ 1, 2, 3 }) != ArrayIterator<int, 3>({ 4, 5, 6 }));
+
+		ASSERT_TRUE(Stream(1, 2, 3) == Stream(1, 2, 3));
+		ASSERT_FALSE(Stream(1, 2, 3) == Stream(4, 5, 6));
+		ASSERT_TRUE(Stream(1, 2, 3) != Stream(1, 2, 4));
+
+		// positions are compared too, elements that are passed already don't matter
+		auto first = Stream(1, 2, 3);
+		auto second = Stream(0, 2, 3);
+		ASSERT_TRUE(first != second);
+		first.incrementSlider();
+		ASSERT_TRUE(first != second);
+		second.incrementSlider();
+		ASSERT_TRUE(first == second);
+	}
+
+	TEST(Stream_Constexpr, runtime_literals) {
+		// non-trivial elements are still kept into shared container
+		auto res = Stream(string("a"), string("b"), string("c")) | sum();
+		ASSERT_EQ(res, "abc");
+
+		int factor = 3;
+		auto multiplied = Stream(1, 2, 3) | map([factor](int a) { return a * factor; }) | to_vector();
+		ASSERT_EQ(multiplied, vector<int>({ 3, 6, 9 }));
+	}
+
+}
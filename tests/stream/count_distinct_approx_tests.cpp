@@ -0,0 +1,86 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	namespace {
+		double relativeError(double estimate, double exact) {
+			return std::abs(estimate - exact) / exact;
+		}
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_CountDistinctApprox, repeated_elements) {
+		uint64_t a = 0;
+		auto sketch = Stream([&a]() { return a++ % 50000; })
+			| get(200000)
+			| count_distinct_approx();
+
+		EXPECT_EQ(sketch.memory(), 16384u);
+		ASSERT_LT(relativeError(sketch.estimate(), 50000.), 0.03);
+	}
+
+	TEST(Stream_CountDistinctApprox, small_cardinality) {
+		auto sketch = Stream(1, 2, 3, 2, 1, 5) | count_distinct_approx();
+		ASSERT_EQ(sketch.count(), 4u);
+
+		vector<int> empty;
+		ASSERT_EQ((Stream(empty) | count_distinct_approx()).count(), 0u);
+	}
+
+	TEST(Stream_CountDistinctApprox, strings) {
+		int a = 0;
+		auto sketch = Stream([&a]() { return std::to_string(a++ % 1000); })
+			| get(5000)
+			| count_distinct_approx(12);
+		ASSERT_LT(relativeError(sketch.estimate(), 1000.), 0.05);
+	}
+
+	TEST(Stream_CountDistinctApprox, merge_of_chunks) {
+		int a = 0;
+		int b = 30000;
+		// overlapping ranges [0, 40000) and [30000, 70000)
+		auto first = Stream([&a]() { return a++; }) | get(40000) | count_distinct_approx();
+		auto second = Stream([&b]() { return b++; }) | get(40000) | count_distinct_approx();
+
+		first.merge(second);
+		ASSERT_LT(relativeError(first.estimate(), 70000.), 0.03);
+		ASSERT_ANY_THROW(first.merge(HyperLogLog(10)));
+	}
+
+	TEST(Stream_CountDistinctApprox, serialization) {
+		int a = 0;
+		auto sketch = Stream([&a]() { return a++; }) | get(1000) | count_distinct_approx(10);
+		auto bytes = sketch.serialize();
+
+		ASSERT_EQ(bytes.size(), 2u + 1024u);
+		auto restored = HyperLogLog::deserialize(bytes);
+		EXPECT_EQ(restored, sketch);
+		EXPECT_EQ(restored.count(), sketch.count());
+
+		bytes.pop_back();
+		ASSERT_ANY_THROW(HyperLogLog::deserialize(bytes));
+	}
+
+	TEST(Stream_CountDistinctApprox, wrong_precision) {
+		ASSERT_ANY_THROW(Stream(1, 2, 3) | count_distinct_approx(3));
+	}
+
+}
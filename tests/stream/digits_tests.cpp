@@ -0,0 +1,90 @@
+#include <iostream>
+#include <vector>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+#include "stream/digits.h"
+#include "long_numbers/big_integer/big_integer_library.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+	using namespace lipaboy_lib::long_numbers_space;
+
+	namespace {
+		// digits of decimal string from least to most significant
+		vector<uint32_t> reversedDigits(string const & str) {
+			vector<uint32_t> res;
+			for (auto iter = str.rbegin(); iter != str.rend(); iter++)
+				res.push_back(uint32_t(*iter - '0'));
+			return res;
+		}
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Digits, long_integer_decimal) {
+		string numStr = "789100000200045";
+		LongIntegerDecimal<3> number(numStr);
+		auto res = digits(number) | to_vector();
+
+		ASSERT_EQ(res, reversedDigits(numStr));
+	}
+
+	TEST(Stream_Digits, long_unsigned) {
+		string numStr = "123456789012345678901";
+		LongUnsigned<3> number(numStr);
+
+		ASSERT_EQ(digits(number) | to_vector(), reversedDigits(numStr));
+		ASSERT_EQ(digits(LongUnsigned<2>(10), 2) | to_vector(), vector<uint32_t>({ 0, 1, 0, 1 }));
+		// 2^32 + 255
+		LongUnsigned<2> big(255);
+		big[1] = 1;
+		ASSERT_EQ(digits(big, 16) | to_vector(),
+			vector<uint32_t>({ 15, 15, 0, 0, 0, 0, 0, 0, 1 }));
+	}
+
+	TEST(Stream_Digits, big_unsigned) {
+		string numStr = "98765432109876543210987654321";
+		BigUnsigned number = stringToBigUnsigned(numStr);
+
+		ASSERT_EQ(digits(number) | to_vector(), reversedDigits(numStr));
+		ASSERT_EQ(digits(BigUnsigned(7), 7) | to_vector(), vector<uint32_t>({ 0, 1 }));
+	}
+
+	TEST(Stream_Digits, zero) {
+		ASSERT_EQ(digits(LongIntegerDecimal<2>(0)) | to_vector(), vector<uint32_t>({ 0 }));
+		ASSERT_EQ(digits(BigUnsigned(0), 3) | to_vector(), vector<uint32_t>({ 0 }));
+	}
+
+	TEST(Stream_Digits, product_of_digits) {
+		LongIntegerDecimal<2> number("277777788888899");
+		auto product = digits(number)
+			| reduce([](uint64_t prod, uint32_t digit) { return prod * digit; },
+				[](uint32_t digit) { return uint64_t(digit); });
+
+		ASSERT_EQ(product.value(), 4996238671872ull);
+	}
+
+	TEST(Stream_Digits, filter_and_distinct) {
+		LongUnsigned<2> number("9007199254740993");
+		auto oddCount = digits(number)
+			| filter([](uint32_t digit) { return digit % 2 == 1; })
+			| count();
+		ASSERT_EQ(oddCount, 10u);
+
+		auto different = digits(number) | distinct() | count();
+		ASSERT_EQ(different, 8u);
+	}
+
+}
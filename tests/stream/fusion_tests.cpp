@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <type_traits>
+
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	namespace {
+		int twice(int a) { return 2 * a; }
+		bool isOdd(int a) { return a % 2 != 0; }
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Fusion, map_map) {
+		vector<int> vec = { 1, 2, 3 };
+		auto stream = Stream(vec)
+			| map([](int a) { return a + 1; })
+			| map([](int a) { return std::to_string(a); });
+
+		using SourceType = decltype(Stream(vec));
+		static_assert(std::is_base_of_v<SourceType, decltype(stream)>
+			&& std::is_same_v<typename decltype(stream)::SubType, SourceType>,
+			"Stream.Fusion error: two maps must be fused into one stage");
+
+		ASSERT_EQ(stream | to_vector(), vector<string>({ "2", "3", "4" }));
+	}
+
+	TEST(Stream_Fusion, filter_filter) {
+		int a = 0;
+		auto stream = Stream([&a]() { return a++; })
+			| get(20)
+			| filter([](int x) { return x % 2 == 0; })
+			| filter([](int x) { return x % 3 == 0; });
+
+		static_assert(std::is_same_v<typename decltype(stream)::SubType::OperatorType, get>,
+			"Stream.Fusion error: two filters must be fused into one stage");
+
+		ASSERT_EQ(stream | to_vector(), vector<int>({ 0, 6, 12, 18 }));
+	}
+
+	TEST(Stream_Fusion, filter_tested_lazily) {
+		int countOfSecondChecks = 0;
+		auto res = Stream(1, 2, 3, 4, 5, 6)
+			| filter([](int x) { return x > 4; })
+			| filter([&countOfSecondChecks](int) { countOfSecondChecks++; return true; })
+			| to_vector();
+
+		EXPECT_EQ(countOfSecondChecks, 2);
+		ASSERT_EQ(res, vector<int>({ 5, 6 }));
+	}
+
+	TEST(Stream_Fusion, map_map_filter_filter) {
+		vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		auto stream = Stream(vec)
+			| map(twice)
+			| map([](int a) { return a + 1; })
+			| filter(isOdd)
+			| filter([](int a) { return a % 3 == 0; });
+
+		using SourceType = decltype(Stream(vec));
+		static_assert(std::is_same_v<typename decltype(stream)::SubType, SourceType>,
+			"Stream.Fusion error: map, map, filter, filter must be fused into one stage");
+
+		ASSERT_EQ(stream | to_vector(), vector<int>({ 3, 9, 15 }));
+	}
+
+	TEST(Stream_Fusion, map_filter_skip) {
+		auto res = Stream(1, 2, 3, 4, 5, 6)
+			| map([](int x) { return x * x; })
+			| filter([](int x) { return x % 2 == 0; })
+			| skip(1)
+			| to_vector();
+
+		ASSERT_EQ(res, vector<int>({ 16, 36 }));
+	}
+
+	TEST(Stream_Fusion, lvalue_stream_is_not_changed) {
+		vector<int> vec = { 1, 2, 3, 4 };
+		auto stream = Stream(vec) | filter([](int x) { return x > 1; });
+		auto first = stream | filter([](int x) { return x < 4; }) | to_vector();
+		auto second = stream | to_vector();
+
+		EXPECT_EQ(first, vector<int>({ 2, 3 }));
+		ASSERT_EQ(second, vector<int>({ 2, 3, 4 }));
+	}
+
+}
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_GroupBySpan, Infinite) {
+		int a = 0;
+		auto res = Stream([&a]() { return a++; })
+			| get(7)
+			| group_by_span(3)
+			| map([](span<const int> part) { return vector<int>(part.begin(), part.end()); })
+			| to_vector();
+
+		ASSERT_EQ(res, decltype(res)({ { 0, 1, 2 }, { 3, 4, 5 }, { 6 } }));
+	}
+
+	TEST(Stream_GroupBySpan, buffer_is_reused) {
+		vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+		const int* prevData = nullptr;
+		bool isSameBuffer = true;
+		auto res = Stream(vec)
+			| group_by_span(2)
+			| map([&](span<const int> part) {
+					if (prevData != nullptr)
+						isSameBuffer = isSameBuffer && (prevData == part.data());
+					prevData = part.data();
+					return part[0] + part[1];
+				})
+			| to_vector();
+
+		EXPECT_TRUE(isSameBuffer);
+		ASSERT_EQ(res, vector<int>({ 3, 7, 11 }));
+	}
+
+	TEST(Stream_GroupBySpan, skip) {
+		int a = 0;
+		auto res = Stream([&a]() { return a++; })
+			| get(4)
+			| group_by_span(2)
+			| skip(1)
+			| map([](span<const int> part) { return part.front() * part.back(); })
+			| nth(0);
+
+		ASSERT_EQ(res, 6);
+	}
+
+	TEST(Stream_GroupBySpan, move_out) {
+		vector<string> words = { "lol", "kek", "cheburek" };
+		auto res = Stream(words)
+			| group_by_span<GroupOwnership::MoveOut>(2)
+			| to_vector();
+
+		ASSERT_EQ(res, decltype(res)({ { "lol", "kek" }, { "cheburek" } }));
+	}
+
+	TEST(Stream_GroupBySpan, move_only_elements) {
+		int a = 0;
+		auto res = Stream([&a]() { return a++; })
+			| get(4)
+			| map([](int x) { return std::make_unique<int>(x); })
+			| group_by_span<GroupOwnership::MoveOut>(4)
+			| nth(0);
+
+		ASSERT_EQ(res.value().size(), 4u);
+		ASSERT_EQ(*res.value()[3], 3);
+	}
+
+	TEST(Stream_GroupBySpan, move_out_bools) {
+		// Info: View mode is rejected for bool by static_assert (std::vector<bool> has no data())
+		auto res = Stream(vector<bool>({ true, false, false, true, true }))
+			| group_by_span<GroupOwnership::MoveOut>(2)
+			| to_vector();
+
+		ASSERT_EQ(res, vector<vector<bool> >({ { true, false }, { false, true }, { true } }));
+	}
+
+}
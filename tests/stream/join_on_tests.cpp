@@ -0,0 +1,120 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+	using std::pair;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	namespace {
+		struct Order {
+			int id;
+			int customerId;
+		};
+		using Customer = pair<int, string>;
+
+		const vector<Order> ORDERS = { { 1, 10 }, { 2, 20 }, { 3, 10 }, { 4, 40 } };
+		const vector<Customer> CUSTOMERS = { { 10, "Ann" }, { 20, "Bob" }, { 30, "Eve" } };
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_JoinOn, inner) {
+		auto res = Stream(ORDERS)
+			| join_on(Stream(CUSTOMERS),
+				[](Order const & order) { return order.customerId; },
+				[](Customer const & customer) { return customer.first; })
+			| map([](auto const & joined) { return std::to_string(joined.first.id) + joined.second.second; })
+			| to_vector();
+
+		ASSERT_EQ(res, vector<string>({ "1Ann", "2Bob", "3Ann" }));
+	}
+
+	TEST(Stream_JoinOn, left_outer) {
+		auto res = Stream(ORDERS)
+			| left_join_on(Stream(CUSTOMERS),
+				[](Order const & order) { return order.customerId; },
+				[](Customer const & customer) { return customer.first; })
+			| map([](auto const & joined) {
+					return joined.second.has_value() ? joined.second->second : string("none");
+				})
+			| to_vector();
+
+		ASSERT_EQ(res, vector<string>({ "Ann", "Bob", "Ann", "none" }));
+	}
+
+	TEST(Stream_JoinOn, many_matches) {
+		vector<int> left = { 1, 2, 3 };
+		vector<int> right = { 1, 1, 3, 3, 3, 5 };
+		auto res = Stream(left)
+			| join_on(Stream(right), [](int a) { return a; }, [](int a) { return a; })
+			| to_vector();
+
+		ASSERT_EQ(res.size(), 5u);
+		ASSERT_EQ(std::count(res.begin(), res.end(), pair<int, int>(1, 1)), 2);
+		ASSERT_EQ(std::count(res.begin(), res.end(), pair<int, int>(3, 3)), 3);
+
+		auto amount = Stream(left)
+			| join_on(Stream(right), [](int a) { return a; }, [](int a) { return a; })
+			| count();
+		ASSERT_EQ(amount, 5u);
+	}
+
+	TEST(Stream_JoinOn, copy_in_the_middle) {
+		vector<int> left = { 3, 1 };
+		vector<int> right = { 1, 1, 3, 3, 3 };
+		auto joined = Stream(left)
+			| join_on(Stream(right), [](int a) { return a; }, [](int a) { return a; });
+		auto original = std::make_optional(joined);
+		ASSERT_TRUE(original->hasNext());
+		ASSERT_EQ(original->nextElem(), (pair<int, int>(3, 3)));
+
+		auto copy = *original;
+		original.reset();
+		auto res = copy | to_vector();
+		ASSERT_EQ(res, (vector<pair<int, int> >({ { 3, 3 }, { 3, 3 }, { 1, 1 }, { 1, 1 } })));
+	}
+
+	TEST(Stream_JoinOn, build_side_memory) {
+		int a = 0;
+		auto joined = Stream(1, 2, 3)
+			| join_on(Stream([&a]() { return a++; }) | get(1000),
+				[](int key) { return key; },
+				[](int key) { return key % 3; });
+		ASSERT_EQ(joined.operation().buildSideSize(), 0u);
+
+		auto res = joined | count();
+		EXPECT_EQ(res, 666u);
+		EXPECT_EQ(joined.operation().buildSideSize(), 1000u);
+		ASSERT_GE(joined.operation().buildSideMemory(), 1000u * sizeof(pair<const int, int>));
+	}
+
+	TEST(Stream_JoinOn, empty_sides) {
+		vector<int> empty;
+		auto inner = Stream(1, 2, 3)
+			| join_on(Stream(empty), [](int a) { return a; }, [](int a) { return a; })
+			| to_vector();
+		ASSERT_TRUE(inner.empty());
+
+		auto outer = Stream(empty)
+			| left_join_on(Stream(1, 2, 3), [](int a) { return a; }, [](int a) { return a; })
+			| to_vector();
+		ASSERT_TRUE(outer.empty());
+	}
+
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Multi, one_pass) {
+		int a = 0;
+		int generatorCalls = 0;
+		auto [total, maximum, amount, elems] = Stream([&a, &generatorCalls]() { generatorCalls++; return a++; })
+			| get(5)
+			| multi(sum(), max(), count(), to_vector());
+
+		EXPECT_EQ(total, 10);
+		EXPECT_EQ(maximum, 4);
+		EXPECT_EQ(amount, 5u);
+		EXPECT_EQ(elems, vector<int>({ 0, 1, 2, 3, 4 }));
+		ASSERT_LE(generatorCalls, 6);
+	}
+
+	TEST(Stream_Multi, histogram_by_reduce) {
+		using Histogram = std::map<int, int>;
+		auto res = Stream(1, 3, 1, 2, 3, 1)
+			| multi(
+				count(),
+				reduce([](Histogram hist, int elem) { hist[elem]++; return hist; },
+					[](int elem) { return Histogram({ { elem, 1 } }); }));
+
+		EXPECT_EQ(std::get<0>(res), 6u);
+		ASSERT_EQ(std::get<1>(res).value(), Histogram({ { 1, 3 }, { 2, 1 }, { 3, 2 } }));
+	}
+
+	TEST(Stream_Multi, empty) {
+		vector<int> vec;
+		auto res = Stream(vec)
+			| multi(sum(-1), max(), count());
+
+		EXPECT_EQ(std::get<0>(res), -1);
+		EXPECT_FALSE(std::get<1>(res).has_value());
+		ASSERT_EQ(std::get<2>(res), 0u);
+	}
+
+	TEST(Stream_Multi, nested_and_print) {
+		std::stringstream out;
+		auto res = Stream(1, 2, 3)
+			| map([](int a) { return a * a; })
+			| multi(multi(sum(), count()), print_to(out, " "));
+
+		EXPECT_EQ(std::get<0>(std::get<0>(res)), 14);
+		EXPECT_EQ(std::get<1>(std::get<0>(res)), 3u);
+		ASSERT_EQ(out.str(), "1 4 9 ");
+	}
+
+	TEST(Stream_Count, filter) {
+		auto res = Stream(1, 2, 3, 4, 5)
+			| filter([](int a) { return a % 2 == 1; })
+			| count();
+		ASSERT_EQ(res, 3u);
+	}
+
+}
@@ -0,0 +1,110 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_ParallelMap, order_is_kept) {
+		int a = 0;
+		auto res = Stream([&a]() { return a++; })
+			| get(1000)
+			| parallel_map([](int elem) {
+					// the later elements are computed faster
+					if (elem % 7 == 0)
+						std::this_thread::sleep_for(std::chrono::microseconds(200));
+					return elem * 2;
+				}, 4, 16)
+			| to_vector();
+
+		ASSERT_EQ(res.size(), 1000u);
+		for (int i = 0; i < 1000; i++)
+			ASSERT_EQ(res[i], 2 * i);
+	}
+
+	TEST(Stream_ParallelMap, downstream_operators) {
+		vector<string> vec = { "1", "22", "333", "4444", "55555" };
+		auto res = Stream(vec)
+			| parallel_map([](string const & str) { return str.size(); }, 3)
+			| filter([](size_t size) { return size % 2 == 1; })
+			| sum();
+
+		ASSERT_EQ(res, 9u);
+	}
+
+	TEST(Stream_ParallelMap, bounded_window) {
+		std::atomic<int> maxInFlight = 0;
+		std::atomic<int> inFlight = 0;
+		int pulled = 0;
+		int a = 0;
+		auto res = Stream([&a, &pulled, &inFlight]() { pulled++; inFlight++; return a++; })
+			| parallel_map([](int elem) { return elem; }, 2, 4)
+			| map([&inFlight, &maxInFlight](int elem) {
+					maxInFlight = std::max(maxInFlight.load(), inFlight.load());
+					inFlight--;
+					return elem;
+				})
+			| get(100)
+			| to_vector();
+
+		EXPECT_EQ(res.size(), 100u);
+		EXPECT_GE(maxInFlight.load(), 1);
+		// window, emitted element and one element produced by generator ahead
+		ASSERT_LE(maxInFlight.load(), 4 + 2);
+		ASSERT_LE(pulled, 100 + 4 + 2);
+	}
+
+	TEST(Stream_ParallelMap, copy_in_the_middle) {
+		vector<int> vec(100);
+		for (int i = 0; i < 100; i++)
+			vec[i] = i;
+		auto original = Stream(vec) | parallel_map([](int elem) { return elem * 2; }, 2, 8);
+		ASSERT_TRUE(original.hasNext());
+		ASSERT_EQ(original.nextElem(), 0);
+
+		vector<int> expected;
+		for (int i = 1; i < 100; i++)
+			expected.push_back(2 * i);
+		auto copy = original;
+		ASSERT_EQ(original | to_vector(), expected);
+		ASSERT_EQ(copy | to_vector(), expected);
+	}
+
+	TEST(Stream_ParallelMap, exception_is_rethrown) {
+		auto stream = Stream(1, 2, 3, 4)
+			| parallel_map([](int elem) {
+					if (elem == 3)
+						throw std::runtime_error("three");
+					return elem;
+				}, 2);
+		ASSERT_THROW(stream | to_vector(), std::runtime_error);
+	}
+
+	TEST(Stream_ParallelMap, wrong_parameters_and_empty) {
+		ASSERT_ANY_THROW(parallel_map([](int a) { return a; }, 0));
+
+		vector<int> empty;
+		auto res = Stream(empty) | parallel_map([](int a) { return a; }, 2) | to_vector();
+		ASSERT_TRUE(res.empty());
+	}
+
+}
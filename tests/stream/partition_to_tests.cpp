@@ -0,0 +1,140 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <list>
+#include <memory>
+#include <iterator>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+	using std::pair;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_PartitionTo, to_vectors) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4, 5, 6, 7 };
+		auto res = Stream(vec)
+			| map([&calls](int a) { calls++; return a; })
+			| partition_to([](int a) { return a % 3 == 0; });
+
+		ASSERT_EQ(res.first, vector<int>({ 3, 6 }));
+		ASSERT_EQ(res.second, vector<int>({ 1, 2, 4, 5, 7 }));
+		// one pass
+		ASSERT_EQ(calls, 7);
+	}
+
+	TEST(Stream_PartitionTo, reservation) {
+		vector<int> vec(1000, 1);
+		vec[0] = 0;
+		auto res = Stream(vec) | partition_to([](int a) { return a == 0; });
+		ASSERT_EQ(res.first.size(), 1);
+		ASSERT_EQ(res.second.size(), 999);
+		// both parts reserved half: the small one was shrunk,
+		// the big one outgrew its half once and reserved the rest (1000 - 1) exactly
+		ASSERT_LT(res.first.capacity(), 500);
+		ASSERT_EQ(res.second.capacity(), 999);
+
+		vector<int> skewed(1000, 1);
+		skewed[999] = 0;
+		res = Stream(skewed) | partition_to([](int a) { return a == 0; });
+		ASSERT_EQ(res.first.size(), 1);
+		ASSERT_EQ(res.second.size(), 999);
+		ASSERT_LT(res.first.capacity(), 500);
+		// small part was empty when the big one outgrew its half
+		ASSERT_EQ(res.second.capacity(), 1000);
+
+		vector<int> numbers;
+		for (int a = 0; a < 1001; a++)
+			numbers.push_back(a);
+		// even split fits into the halves
+		auto balanced = Stream(numbers) | partition_to([](int a) { return a % 2 == 0; });
+		ASSERT_EQ(balanced.first.size(), 501);
+		ASSERT_EQ(balanced.second.size(), 500);
+		ASSERT_EQ(balanced.first.capacity(), 501);
+		ASSERT_EQ(balanced.second.capacity(), 501);
+
+		// both parts never hold more than 1.5 * N elements
+		numbers.pop_back();
+		auto unbalanced = Stream(numbers) | partition_to([](int a) { return a % 4 != 0; });
+		ASSERT_EQ(unbalanced.first.size(), 750);
+		ASSERT_LE(unbalanced.first.capacity() + unbalanced.second.capacity(), 1500);
+
+		auto hinted = Stream(vec) | filter([](int a) { return a > 0; }) | partition_to([](int) { return true; }, 100);
+		ASSERT_EQ(hinted.first.size(), 999);
+		ASSERT_TRUE(hinted.second.empty());
+		ASSERT_EQ(hinted.second.capacity(), 0);
+	}
+
+	TEST(Stream_PartitionTo, predicate_is_called_once_per_element) {
+		int calls = 0;
+		auto pred = [&calls](int a) { calls++; return a > 1; };
+		auto res = Stream(vector<int>({ 1, 2, 3 })) | partition_to(pred);
+		ASSERT_EQ(res.first, vector<int>({ 2, 3 }));
+		ASSERT_EQ(calls, 3);
+
+		calls = 0;
+		vector<int> rest;
+		Stream(1, 2, 3) | partition_to(pred, std::back_inserter(rest), std::back_inserter(rest));
+		ASSERT_EQ(calls, 3);
+	}
+
+	TEST(Stream_PartitionTo, to_iterators) {
+		vector<string> valid;
+		std::list<string> invalid;
+		auto ends = Stream(string("ok"), string(""), string("fine"), string(""))
+			| partition_to([](string const & str) { return !str.empty(); },
+				std::back_inserter(valid), std::back_inserter(invalid));
+		ASSERT_EQ(valid, vector<string>({ "ok", "fine" }));
+		ASSERT_EQ(invalid.size(), 2);
+		// returned inserters go on appending into the same containers
+		*ends.first = "more";
+		*ends.second = "";
+		ASSERT_EQ(valid.back(), "more");
+		ASSERT_EQ(invalid.size(), 3);
+
+		int arr[5] = {};
+		vector<int> rest(5);
+		auto [arrEnd, restEnd] = Stream(1, 2, 3, 4, 5)
+			| partition_to([](int a) { return a % 2 == 1; }, arr, rest.begin());
+		ASSERT_EQ(arrEnd - arr, 3);
+		ASSERT_EQ(restEnd - rest.begin(), 2);
+		ASSERT_EQ(arr[2], 5);
+		ASSERT_EQ(rest[1], 4);
+	}
+
+	TEST(Stream_PartitionTo, move_only_elements) {
+		vector<std::unique_ptr<int> > ptrs;
+		for (int a : { 1, 2, 3 })
+			ptrs.push_back(std::make_unique<int>(a));
+		auto res = Stream(std::make_move_iterator(ptrs.begin()), std::make_move_iterator(ptrs.end()))
+			| partition_to([](std::unique_ptr<int> const & p) { return *p > 1; });
+		ASSERT_EQ(res.first.size(), 2);
+		ASSERT_EQ(*res.second[0], 1);
+	}
+
+	TEST(Stream_PartitionCount, simple) {
+		auto counts = Stream(1, 2, 3, 4, 5) | partition_count([](int a) { return a > 3; });
+		ASSERT_EQ(counts, (pair<size_t, size_t>(2, 3)));
+
+		auto [vectors, total] = Stream(1, 2, 3, 4)
+			| multi(partition_to([](int a) { return a % 2 == 0; }), partition_count([](int a) { return a < 0; }));
+		ASSERT_EQ(vectors.first, vector<int>({ 2, 4 }));
+		ASSERT_EQ(total, (pair<size_t, size_t>(0, 4)));
+	}
+
+}
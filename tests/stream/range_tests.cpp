@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <optional>
+#include <limits>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Range, common) {
+		ASSERT_EQ(range(1, 10, 3) | to_vector(), vector<int>({ 1, 4, 7 }));
+		ASSERT_EQ(range(10, 0, -3) | to_vector(), vector<int>({ 10, 7, 4, 1 }));
+		ASSERT_EQ(range(2, 5) | to_vector(), vector<int>({ 2, 3, 4 }));
+		ASSERT_EQ(range(0.0, 1.0, 0.25) | to_vector(), vector<double>({ 0.0, 0.25, 0.5, 0.75 }));
+		ASSERT_EQ(iota(4u) | to_vector(), vector<unsigned>({ 0, 1, 2, 3 }));
+
+		ASSERT_TRUE((range(5, 5) | to_vector()).empty());
+		ASSERT_TRUE((range(5, 1) | to_vector()).empty());
+		ASSERT_ANY_THROW(range(1, 5, 0));
+	}
+
+	TEST(Stream_Range, size_and_jumps) {
+		const long long SIZE = static_cast<long long>(1e15);
+		ASSERT_EQ(iota(SIZE) | count(), static_cast<size_t>(SIZE));
+		ASSERT_EQ(iota(SIZE) | skip(SIZE - 2) | to_vector(), vector<long long>({ SIZE - 2, SIZE - 1 }));
+		ASSERT_EQ(range(0LL, SIZE, 5LL) | nth(SIZE / 5 - 1), std::optional<long long>(SIZE - 5));
+		ASSERT_EQ(iota(10) | nth(10), std::nullopt);
+
+		auto stream = iota(100);
+		ASSERT_EQ(stream.restSize(), 100u);
+		stream.advanceSlider(1000);
+		ASSERT_FALSE(stream.hasNext());
+	}
+
+	TEST(Stream_Range, wide_signed_bounds) {
+		constexpr int MIN = std::numeric_limits<int>::min();
+		constexpr int MAX = std::numeric_limits<int>::max();
+		ASSERT_EQ(range(MIN, MAX) | count(), 0xFFFFFFFFu);
+		ASSERT_EQ(range(MIN, MAX) | skip(0xFFFFFFFDu) | to_vector(), vector<int>({ MAX - 2, MAX - 1 }));
+		ASSERT_EQ(range(MAX, MIN, -1) | nth(0xFFFFFFFEu), std::optional<int>(MIN + 1));
+		ASSERT_EQ(range(MIN, MAX, MAX) | to_vector(), vector<int>({ MIN, -1, MAX - 1 }));
+
+		constexpr int64_t MIN64 = std::numeric_limits<int64_t>::min();
+		constexpr int64_t MAX64 = std::numeric_limits<int64_t>::max();
+		ASSERT_EQ(range(MIN64, MAX64, MAX64) | to_vector(), vector<int64_t>({ MIN64, -1, MAX64 - 1 }));
+		ASSERT_EQ(range(MAX64, MIN64, MIN64) | to_vector(), vector<int64_t>({ MAX64, -1 }));
+	}
+
+	TEST(Stream_Range, pipeline) {
+		auto res = range(1, 100, 2)
+			| map([](int a) { return a * a; })
+			| filter([](int a) { return a % 3 == 0; })
+			| get(3)
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 9, 81, 225 }));
+		ASSERT_EQ(iota(10) | reverse() | nth(0), std::optional<int>(9));
+
+		constexpr auto total = iota(5) | map([](int a) { return a * 2; }) | sum();
+		static_assert(total == 20);
+	}
+
+	TEST(Stream_Range, split_into_parts) {
+		auto ranges = splitIntoParts(iota(10), 3);
+		ASSERT_EQ(ranges.size(), 3u);
+		vector<int> sizes;
+		int total = 0;
+		for (auto & part : ranges) {
+			sizes.push_back(static_cast<int>(part.restSize()));
+			total += part | sum();
+		}
+		ASSERT_EQ(sizes, vector<int>({ 4, 3, 3 }));
+		ASSERT_EQ(total, 45);
+
+		vector<string> vec = { "a", "b", "c", "d" };
+		auto halves = splitIntoParts(Stream(vec), 2);
+		ASSERT_EQ(halves[1] | to_vector(), vector<string>({ "c", "d" }));
+
+		// size * parts doesn't fit into size_t
+		const int64_t last = std::numeric_limits<int64_t>::max();
+		auto wide = splitIntoParts(range<int64_t>(0, last), 4);
+		int64_t next = 0;
+		for (size_t i = 0; i < wide.size(); i++) {
+			const size_t partSize = wide[i].restSize();
+			ASSERT_EQ(partSize, size_t(last / 4) + ((i < size_t(last % 4)) ? 1 : 0));
+			ASSERT_EQ(wide[i] | nth(0), std::optional<int64_t>(next));
+			next += int64_t(partSize);
+		}
+		ASSERT_EQ(next, last);
+	}
+
+}
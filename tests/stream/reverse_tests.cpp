@@ -0,0 +1,73 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <list>
+#include <iterator>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Reverse, bidirectional_source) {
+		std::list<string> lst = { "a", "b", "c" };
+		auto stream = Stream(lst) | reverse();
+		// no buffering: the source is walked backwards
+		static_assert(std::is_same_v<decltype(stream),
+			StreamBase<std::reverse_iterator<std::list<string>::const_iterator> > >);
+
+		ASSERT_EQ(stream | to_vector(), vector<string>({ "c", "b", "a" }));
+	}
+
+	TEST(Stream_Reverse, maps_before_reverse) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4 };
+		auto stream = Stream(vec)
+			| map([&calls](int a) { calls++; return a * 10; })
+			| map([](int a) { return std::to_string(a); })
+			| reverse();
+		static_assert(!std::is_base_of_v<reverse_impl<string>, typename decltype(stream)::OperatorType>);
+
+		auto res = stream | skip(1) | to_vector();
+		ASSERT_EQ(res, vector<string>({ "30", "20", "10" }));
+		ASSERT_EQ(calls, 3);
+	}
+
+	TEST(Stream_Reverse, buffered_fallback) {
+		auto res = Stream(1, 2, 3, 4, 5)
+			| filter([](int a) { return a % 2 == 1; })
+			| reverse()
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 5, 3, 1 }));
+
+		int a = 0;
+		auto amount = Stream([&a]() { return a++; }) | get(1000) | reverse() | skip(10) | nth(0);
+		ASSERT_EQ(amount, std::optional<int>(989));
+
+		vector<int> empty;
+		ASSERT_TRUE((Stream(empty) | filter([](int) { return true; }) | reverse() | to_vector()).empty());
+	}
+
+	TEST(Stream_Reverse, partially_consumed_source) {
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+		auto stream = Stream(vec);
+		stream.incrementSlider();
+		stream.incrementSlider();
+		ASSERT_EQ(stream | reverse() | to_vector(), vector<int>({ 5, 4, 3 }));
+	}
+
+}
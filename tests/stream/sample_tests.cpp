@@ -0,0 +1,100 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Sample, deterministic_and_unique) {
+		int a = 0;
+		auto first = Stream([&a]() { return a++; }) | get(100000) | sample(50, 7);
+		a = 0;
+		auto second = Stream([&a]() { return a++; }) | get(100000) | sample(50, 7);
+		a = 0;
+		auto other = Stream([&a]() { return a++; }) | get(100000) | sample(50, 8);
+
+		EXPECT_EQ(first, second);
+		EXPECT_NE(first, other);
+		ASSERT_EQ(first.size(), 50u);
+		ASSERT_EQ(std::set<int>(first.begin(), first.end()).size(), 50u);
+		ASSERT_TRUE(std::all_of(first.begin(), first.end(),
+			[](int elem) { return elem >= 0 && elem < 100000; }));
+	}
+
+	TEST(Stream_Sample, short_stream) {
+		auto res = Stream(1, 2, 3) | sample(5);
+		ASSERT_EQ(res, vector<int>({ 1, 2, 3 }));
+	}
+
+	TEST(Stream_Sample, uniformity) {
+		// every element must get into sample with probability k / N
+		constexpr int N = 20;
+		vector<int> hits(N, 0);
+		for (uint64_t seed = 0; seed < 4000; seed++) {
+			int a = 0;
+			auto res = Stream([&a]() { return a++; }) | get(N) | sample(5, seed);
+			for (int elem : res)
+				hits[elem]++;
+		}
+		// expected 1000 hits for each element
+		for (int elem = 0; elem < N; elem++)
+			ASSERT_NEAR(hits[elem], 1000, 150) << "element " << elem;
+	}
+
+	TEST(Stream_Sample, in_multi) {
+		int a = 0;
+		auto [amount, elems] = Stream([&a]() { return a++; })
+			| get(1000)
+			| multi(count(), sample(10, 3));
+		a = 0;
+		auto direct = Stream([&a]() { return a++; }) | get(1000) | sample(10, 3);
+
+		EXPECT_EQ(amount, 1000u);
+		ASSERT_EQ(elems, direct);
+	}
+
+	TEST(Stream_Bernoulli, probability) {
+		int a = 0;
+		auto amount = Stream([&a]() { return a++; })
+			| get(100000)
+			| bernoulli(0.1, 42)
+			| count();
+		ASSERT_NEAR(double(amount), 10000., 500.);
+	}
+
+	TEST(Stream_Bernoulli, deterministic_and_ordered) {
+		int a = 0;
+		auto first = Stream([&a]() { return a++; }) | get(1000) | bernoulli(0.05, 1) | to_vector();
+		a = 0;
+		auto second = Stream([&a]() { return a++; }) | get(1000) | bernoulli(0.05, 1) | to_vector();
+
+		EXPECT_EQ(first, second);
+		ASSERT_TRUE(std::is_sorted(first.begin(), first.end()));
+		ASSERT_TRUE(std::adjacent_find(first.begin(), first.end()) == first.end());
+	}
+
+	TEST(Stream_Bernoulli, whole_and_wrong) {
+		auto res = Stream(1, 2, 3) | bernoulli(1.) | to_vector();
+		ASSERT_EQ(res, vector<int>({ 1, 2, 3 }));
+		ASSERT_ANY_THROW(Stream(1, 2, 3) | bernoulli(0.) | to_vector());
+		ASSERT_ANY_THROW(Stream(1, 2, 3) | sample(0));
+	}
+
+}
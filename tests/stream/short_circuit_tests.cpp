@@ -0,0 +1,130 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_ShortCircuit, any_all_none) {
+		vector<int> vec = { 1, 3, 5, 6, 7 };
+
+		ASSERT_TRUE(Stream(vec) | any_of([](int a) { return a % 2 == 0; }));
+		ASSERT_FALSE(Stream(vec) | all_of([](int a) { return a % 2 == 1; }));
+		ASSERT_FALSE(Stream(vec) | none_of([](int a) { return a > 6; }));
+		ASSERT_TRUE(Stream(vec) | none_of([](int a) { return a > 7; }));
+
+		vector<int> empty;
+		ASSERT_FALSE(Stream(empty) | any_of([](int) { return true; }));
+		ASSERT_TRUE(Stream(empty) | all_of([](int) { return false; }));
+		ASSERT_TRUE(Stream(empty) | none_of([](int) { return true; }));
+	}
+
+	TEST(Stream_ShortCircuit, stops_pulling) {
+		int pulled = 0;
+		auto counted = [&pulled](int a) { pulled++; return a; };
+		vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+		ASSERT_TRUE(Stream(vec) | map(counted) | any_of([](int a) { return a == 3; }));
+		ASSERT_EQ(pulled, 3);
+
+		pulled = 0;
+		ASSERT_FALSE(Stream(vec) | map(counted) | all_of([](int a) { return a < 2; }));
+		ASSERT_EQ(pulled, 2);
+	}
+
+	TEST(Stream_ShortCircuit, infinite_streams) {
+		int a = 0;
+		ASSERT_TRUE(Stream([&a]() { return a++; }) | any_of([](int elem) { return elem > 100; }));
+		// generator produces one element ahead
+		ASSERT_EQ(a, 103);
+
+		int b = 0;
+		auto found = Stream([&b]() { return b++; })
+			| map([](int elem) { return elem * elem; })
+			| find_first([](int elem) { return elem > 50; });
+		ASSERT_EQ(found, std::optional<int>(64));
+
+		int c = 0;
+		auto nthElem = Stream([&c]() { return c++; }) | nth(5);
+		ASSERT_EQ(nthElem, std::optional<int>(5));
+	}
+
+	TEST(Stream_ShortCircuit, find_first) {
+		vector<string> vec = { "a", "bb", "ccc", "dd" };
+		ASSERT_EQ(Stream(vec) | find_first([](string const & str) { return str.size() == 2; }),
+			std::optional<string>("bb"));
+		ASSERT_EQ(Stream(vec) | find_first([](string const & str) { return str.empty(); }),
+			std::nullopt);
+	}
+
+	TEST(Stream_TakeWhile, finite_and_infinite) {
+		vector<int> vec = { 1, 2, 3, 10, 4, 5 };
+		auto res = Stream(vec) | take_while([](int a) { return a < 5; }) | to_vector();
+		ASSERT_EQ(res, vector<int>({ 1, 2, 3 }));
+
+		int a = 0;
+		// take_while makes infinite stream finite
+		auto amount = Stream([&a]() { return a++; })
+			| take_while([](int elem) { return elem < 1000; })
+			| count();
+		ASSERT_EQ(amount, 1000u);
+
+		vector<string> strings = { "a", "b", "", "c" };
+		auto strs = Stream(strings)
+			| take_while([](string const & str) { return !str.empty(); })
+			| skip(1)
+			| to_vector();
+		ASSERT_EQ(strs, vector<string>({ "b" }));
+	}
+
+	TEST(Stream_TakeWhile, copy_of_started_stream) {
+		vector<string> strings = { "first", "second", "" };
+		auto stream = Stream(strings) | take_while([](string const & str) { return !str.empty(); });
+		ASSERT_TRUE(stream.hasNext());
+
+		// copy shares the checked element, so the original mustn't move it out
+		auto copy = stream;
+		ASSERT_EQ(stream.nextElem(), "first");
+		ASSERT_EQ(copy | to_vector(), vector<string>({ "first", "second" }));
+		ASSERT_EQ(stream | to_vector(), vector<string>({ "second" }));
+
+		auto dropping = Stream(strings) | drop_while([](string const & str) { return str == "first"; });
+		ASSERT_TRUE(dropping.hasNext());
+		auto droppingCopy = dropping;
+		ASSERT_EQ(dropping.nextElem(), "second");
+		ASSERT_EQ(droppingCopy | to_vector(), vector<string>({ "second", "" }));
+	}
+
+	TEST(Stream_DropWhile, common) {
+		vector<int> vec = { 1, 2, 3, 10, 4, 5 };
+		auto res = Stream(vec) | drop_while([](int a) { return a < 5; }) | to_vector();
+		ASSERT_EQ(res, vector<int>({ 10, 4, 5 }));
+
+		auto all = Stream(vec) | drop_while([](int a) { return a < 100; }) | to_vector();
+		ASSERT_TRUE(all.empty());
+
+		int a = 0;
+		auto found = Stream([&a]() { return a++; })
+			| drop_while([](int elem) { return elem < 10; })
+			| skip(2)
+			| nth(0);
+		ASSERT_EQ(found, std::optional<int>(12));
+	}
+
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_SortedRadix, unsigned_keys) {
+		std::mt19937_64 gen(42);
+		vector<uint64_t> vec(100000);
+		for (auto & elem : vec)
+			elem = gen();
+
+		auto res = Stream(vec) | sorted_radix([](uint64_t a) { return a; }) | to_vector();
+
+		std::sort(vec.begin(), vec.end());
+		ASSERT_EQ(res, vec);
+	}
+
+	TEST(Stream_SortedRadix, signed_and_floating_point_keys) {
+		auto ints = Stream(5, -3, 0, std::numeric_limits<int>::min(), 7, -1)
+			| sorted_radix([](int a) { return a; })
+			| to_vector();
+		ASSERT_EQ(ints, vector<int>({ std::numeric_limits<int>::min(), -3, -1, 0, 5, 7 }));
+
+		auto doubles = Stream(2.5, -0.5, 0., -100., 1e-300, -1e300)
+			| sorted_radix([](double a) { return a; })
+			| to_vector();
+		ASSERT_EQ(doubles, vector<double>({ -1e300, -100., -0.5, 0., 1e-300, 2.5 }));
+
+		auto floats = Stream(1.f, -2.f, 0.25f) | sorted_radix([](float a) { return a; }) | to_vector();
+		ASSERT_EQ(floats, vector<float>({ -2.f, 0.25f, 1.f }));
+	}
+
+	TEST(Stream_SortedRadix, stable_by_key) {
+		vector<string> vec = { "ccc", "a", "bb", "b", "aaa", "c", "" };
+		auto res = Stream(vec)
+			| sorted_radix([](string const & str) { return str.size(); })
+			| to_vector();
+		ASSERT_EQ(res, vector<string>({ "", "a", "b", "c", "bb", "ccc", "aaa" }));
+	}
+
+	TEST(Stream_SortedRadix, parallel_scatter) {
+		std::mt19937 gen(7);
+		vector<std::pair<uint32_t, int> > vec(300000);
+		for (size_t i = 0; i < vec.size(); i++)
+			vec[i] = { gen() % 1000, int(i) };
+
+		auto res = Stream(vec)
+			| sorted_radix([](std::pair<uint32_t, int> const & p) { return p.first; }, 4)
+			| to_vector();
+
+		std::stable_sort(vec.begin(), vec.end(),
+			[](auto const & l, auto const & r) { return l.first < r.first; });
+		ASSERT_EQ(res, vec);
+	}
+
+	TEST(Stream_SortedRadix, parallel_scatter_of_small_elements) {
+		std::mt19937_64 gen(11);
+		vector<uint64_t> vec(400000);
+		for (auto & elem : vec)
+			elem = gen();
+
+		// sorted directly, histograms of chunks for every pass are counted while scattering
+		auto res = Stream(vec) | sorted_radix([](uint64_t a) { return a; }, 3) | to_vector();
+
+		std::sort(vec.begin(), vec.end());
+		ASSERT_EQ(res, vec);
+	}
+
+	TEST(Stream_SortedRadix, keys_are_projected_once) {
+		vector<string> vec = { "dd", "a", "ccc", "", "bb" };
+		int calls = 0;
+		auto res = Stream(vec)
+			| sorted_radix([&calls](string const & str) { calls++; return -int(str.size()); })
+			| to_vector();
+		ASSERT_EQ(res, vector<string>({ "ccc", "dd", "bb", "a", "" }));
+		ASSERT_EQ(calls, 5);
+
+		// elements are moved once, so they needn't be default constructible or assignable
+		vector<std::unique_ptr<const int> > ptrs;
+		for (int a : { 3, 1, 2 })
+			ptrs.push_back(std::make_unique<const int>(a));
+		auto sorted = Stream(std::make_move_iterator(ptrs.begin()), std::make_move_iterator(ptrs.end()))
+			| sorted_radix([](std::unique_ptr<const int> const & p) { return *p; })
+			| map([](std::unique_ptr<const int> p) { return *p; })
+			| to_vector();
+		ASSERT_EQ(sorted, vector<int>({ 1, 2, 3 }));
+	}
+
+	TEST(Stream_SortedRadix, pipeline_and_errors) {
+		int a = 0;
+		auto res = Stream([&a]() { return a++; })
+			| get(10)
+			| sorted_radix([](int x) { return -x; })
+			| skip(2)
+			| get(3)
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 7, 6, 5 }));
+
+		ASSERT_EQ(Stream(vector<int>()) | sorted_radix([](int x) { return x; }) | count(), 0);
+
+		ASSERT_THROW(sorted_radix([](int x) { return x; }, 0), std::logic_error);
+	}
+
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdint>
+
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Stats, simple) {
+		auto res = Stream(2., 4., 4., 4., 5., 5., 7., 9.)
+			| stats();
+
+		EXPECT_EQ(res.count(), 8u);
+		EXPECT_DOUBLE_EQ(res.mean(), 5.);
+		EXPECT_DOUBLE_EQ(res.variance(), 4.);
+		EXPECT_DOUBLE_EQ(res.sampleVariance(), 32. / 7.);
+		EXPECT_EQ(res.min(), 2.);
+		EXPECT_EQ(res.max(), 9.);
+		ASSERT_EQ(res.quantile(0.5), 4.);
+	}
+
+	TEST(Stream_Stats, empty) {
+		vector<int> vec;
+		auto res = Stream(vec) | stats();
+
+		EXPECT_TRUE(res.empty());
+		EXPECT_FALSE(res.min().has_value());
+		ASSERT_FALSE(res.quantile(0.5).has_value());
+	}
+
+	TEST(Stream_Stats, many_blocks_and_quantiles) {
+		int64_t a = 0;
+		const int64_t N = 200000;
+		auto res = Stream([&a]() { return a++; })
+			| get(N)
+			| stats();
+
+		EXPECT_EQ(res.count(), uint64_t(N));
+		EXPECT_DOUBLE_EQ(res.mean(), double(N - 1) / 2.);
+		EXPECT_NEAR(res.variance(), (double(N) * double(N) - 1.) / 12., 1e-6 * double(N) * double(N));
+		EXPECT_EQ(res.min(), 0);
+		EXPECT_EQ(res.max(), N - 1);
+		// bounded memory
+		EXPECT_LT(res.sketch().retained(), 1000u);
+		for (double q : { 0.01, 0.25, 0.5, 0.75, 0.99 })
+			EXPECT_NEAR(double(res.quantile(q).value()), q * double(N), 0.02 * double(N));
+	}
+
+	TEST(Stream_Stats, merge) {
+		int a = 0;
+		int b = 1000;
+		auto first = Stream([&a]() { return a++; }) | get(1000) | stats();
+		auto second = Stream([&b]() { return b++; }) | get(1000) | stats();
+		first.merge(second);
+
+		EXPECT_EQ(first.count(), 2000u);
+		EXPECT_DOUBLE_EQ(first.mean(), 999.5);
+		EXPECT_EQ(first.max(), 1999);
+		ASSERT_NEAR(double(first.quantile(0.5).value()), 1000., 40.);
+	}
+
+	TEST(Stream_Stats, nan_is_skipped) {
+		const double nan = std::nan("");
+		vector<double> vec;
+		for (int i = 0; i < 1000; i++)
+			vec.push_back((i % 3 == 0) ? nan : double(i % 10));
+		auto res = Stream(vec) | stats(8);
+
+		EXPECT_EQ(res.nanCount(), 334u);
+		EXPECT_EQ(res.count(), 666u);
+		EXPECT_EQ(res.min(), 0.);
+		EXPECT_EQ(res.max(), 9.);
+		EXPECT_FALSE(std::isnan(res.mean()));
+		const double median = res.quantile(0.5).value();
+		EXPECT_FALSE(std::isnan(median));
+		ASSERT_NEAR(median, 5., 2.);
+	}
+
+	TEST(Stream_Stats, in_multi) {
+		auto res = Stream(1, 2, 3, 4)
+			| multi(stats(), sum());
+
+		EXPECT_DOUBLE_EQ(std::get<0>(res).mean(), 2.5);
+		ASSERT_EQ(std::get<1>(res), 10);
+	}
+
+}
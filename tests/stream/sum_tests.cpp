@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_SumPairwise, small_streams) {
+		ASSERT_EQ(Stream(vector<double>()) | sum_pairwise(), 0.);
+		ASSERT_EQ(Stream(1., 2., 3.) | sum_pairwise(), 6.);
+		ASSERT_EQ(Stream(1.5f, 2.5f, 3.f) | sum_pairwise(), 7.f);
+
+		double a = 0.;
+		ASSERT_EQ(Stream([&a]() { return a += 1.; }) | get(1000) | sum_pairwise(), 500500.);
+	}
+
+	TEST(Stream_SumPairwise, accuracy) {
+		const size_t size = 1000000;
+		auto serial = Stream([]() { return 0.1; }) | get(size) | sum();
+		auto pairwise = Stream([]() { return 0.1; }) | get(size) | sum_pairwise();
+
+		const double exact = 1e5;
+		ASSERT_GT(std::abs(serial - exact), 1e-7);
+		ASSERT_LT(std::abs(pairwise - exact), 1e-9);
+	}
+
+	TEST(Stream_SumKahan, cancellation) {
+		// plain Kahan's summation gives 0 here
+		ASSERT_EQ(Stream(1e100, 1., -1e100) | sum_kahan(), 1.);
+		ASSERT_EQ(Stream(1., 1e100, 1., 1., -1e100, 1.) | sum_kahan(), 4.);
+		ASSERT_EQ(Stream(vector<double>()) | sum_kahan(), 0.);
+
+		vector<double> vec;
+		for (int i = 0; i < 1000; i++) {
+			vec.push_back(1e16);
+			vec.push_back(1.);
+			vec.push_back(-1e16);
+		}
+		ASSERT_EQ(Stream(vec) | sum_kahan(), 1000.);
+	}
+
+	TEST(Stream_SumKahan, cancellation_inside_lane) {
+		// every 8-th element gets to the same lane
+		vector<double> vec(8 * 3, 1.);
+		vec[0] = 1e100;
+		vec[16] = -1e100;
+		ASSERT_EQ(Stream(vec) | sum_kahan(), 22.);
+		ASSERT_EQ(Stream(vec) | filter([](double) { return true; }) | sum_kahan(), 22.);
+		ASSERT_EQ(std::get<0>(Stream(vec) | multi(sum_kahan())), 22.);
+	}
+
+	TEST(Stream_SumKahan, accuracy_and_multi) {
+		const size_t size = 1000000;
+		auto kahan = Stream([]() { return 0.1; }) | get(size) | sum_kahan();
+		ASSERT_EQ(kahan, 1e5);
+
+		auto [pairwise, compensated] = Stream(0.5, 0.25, 0.125, 0.125)
+			| multi(sum_pairwise(), sum_kahan());
+		ASSERT_EQ(pairwise, 1.);
+		ASSERT_EQ(compensated, 1.);
+	}
+
+}
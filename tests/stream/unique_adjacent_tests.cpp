@@ -0,0 +1,91 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <cctype>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+	using std::pair;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_UniqueAdjacent, simple) {
+		auto res = Stream(1, 1, 2, 2, 2, 3, 1, 1) | unique_adjacent() | to_vector();
+		ASSERT_EQ(res, vector<int>({ 1, 2, 3, 1 }));
+
+		ASSERT_EQ(Stream(vector<int>()) | unique_adjacent() | count(), 0);
+		ASSERT_EQ(Stream(5, 5, 5) | unique_adjacent() | to_vector(), vector<int>({ 5 }));
+	}
+
+	TEST(Stream_UniqueAdjacent, compares_with_kept_element) {
+		// every element is close to the previous one but not to the first element of run
+		auto res = Stream(1, 2, 3, 4, 5, 6)
+			| unique_adjacent([](int kept, int elem) { return elem - kept < 2; })
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 1, 3, 5 }));
+
+		auto words = Stream(string("Ab"), string("aB"), string("c"), string("C"))
+			| unique_adjacent([](string const & l, string const & r) {
+				return std::tolower(l[0]) == std::tolower(r[0]);
+			})
+			| to_vector();
+		ASSERT_EQ(words, vector<string>({ "Ab", "c" }));
+	}
+
+	TEST(Stream_UniqueAdjacent, move_only_and_infinite) {
+		vector<std::unique_ptr<int> > ptrs;
+		for (int a : { 1, 1, 2, 3, 3 })
+			ptrs.push_back(std::make_unique<int>(a));
+		auto res = Stream(std::make_move_iterator(ptrs.begin()), std::make_move_iterator(ptrs.end()))
+			| unique_adjacent([](auto const & l, auto const & r) { return *l == *r; })
+			| map([](std::unique_ptr<int> p) { return *p; })
+			| to_vector();
+		ASSERT_EQ(res, vector<int>({ 1, 2, 3 }));
+
+		int a = 0;
+		auto firsts = Stream([&a]() { return (a++) / 3; }) | unique_adjacent() | get(4) | to_vector();
+		ASSERT_EQ(firsts, vector<int>({ 0, 1, 2, 3 }));
+	}
+
+	TEST(Stream_RunLength, simple) {
+		auto res = Stream(string("a"), string("a"), string("b"), string("a"), string("c"), string("c"))
+			| run_length()
+			| to_vector();
+		ASSERT_EQ(res, (vector<pair<string, size_t> >({ { "a", 2 }, { "b", 1 }, { "a", 1 }, { "c", 2 } })));
+
+		ASSERT_EQ(Stream(vector<int>()) | run_length() | count(), 0);
+	}
+
+	TEST(Stream_RunLength, after_sort) {
+		vector<int> logs = { 3, 1, 3, 2, 3, 1 };
+		auto res = Stream(logs)
+			| sorted_radix([](int a) { return a; })
+			| run_length()
+			| skip(1)
+			| to_vector();
+		ASSERT_EQ(res, (vector<pair<int, size_t> >({ { 2, 1 }, { 3, 3 } })));
+
+		auto total = Stream(logs)
+			| sorted_radix([](int a) { return a; })
+			| run_length([](int l, int r) { return l / 2 == r / 2; })
+			| map([](pair<int, size_t> p) { return p.second; })
+			| to_vector();
+		ASSERT_EQ(total, vector<size_t>({ 2, 4 }));
+	}
+
+}
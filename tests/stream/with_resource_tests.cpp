@@ -0,0 +1,291 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory_resource>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	namespace {
+		class CountingResource : public std::pmr::memory_resource {
+		public:
+			size_t allocations() const { return allocations_; }
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override {
+				allocations_++;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+			void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+				std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+			}
+			bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override {
+				return this == &other;
+			}
+
+		private:
+			size_t allocations_ = 0;
+		};
+
+		// Info: any allocation by default resource fails while guard is alive
+		struct DefaultResourceGuard {
+			DefaultResourceGuard() : pPrev_(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+			~DefaultResourceGuard() { std::pmr::set_default_resource(pPrev_); }
+
+			std::pmr::memory_resource* pPrev_;
+		};
+	}
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_WithResource, group_by_vector_and_to_vector) {
+		CountingResource resource;
+		vector<int> vec = { 1, 2, 3, 4, 5 };
+
+		auto res = Stream(vec)
+			| with_resource(&resource)
+			| group_by_vector(2)
+			| to_vector();
+
+		static_assert(std::is_same_v<decltype(res), std::pmr::vector<std::pmr::vector<int> > >);
+		ASSERT_EQ(res.size(), 3u);
+		ASSERT_EQ(res[2], std::pmr::vector<int>({ 5 }));
+		ASSERT_EQ(res.get_allocator().resource(), &resource);
+		ASSERT_EQ(res[0].get_allocator().resource(), &resource);
+		ASSERT_GE(resource.allocations(), 4u);
+	}
+
+	TEST(Stream_WithResource, no_default_allocations) {
+		std::byte buffer[4096];
+		std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+		string text = "one two  three";
+
+		DefaultResourceGuard guard;
+		auto words = Stream(text)
+			| with_resource(&arena)
+			| split<string>([](char ch) { return ch == ' '; })
+			| distinct()
+			| filter([](auto const & word) { return word.size() > 2; })
+			| to_vector();
+
+		ASSERT_EQ(words.size(), 3u);
+		ASSERT_EQ(words[2], "three");
+	}
+
+	TEST(Stream_WithResource, multi_and_distinct) {
+		CountingResource resource;
+		vector<int> vec = { 3, 1, 3, 2, 1 };
+
+		auto [elems, amount] = Stream(vec)
+			| with_resource(&resource)
+			| multi(to_vector(), count());
+		ASSERT_EQ(elems.get_allocator().resource(), &resource);
+		ASSERT_EQ(elems.size(), 5u);
+		ASSERT_EQ(amount, 5u);
+		const size_t allocations = resource.allocations();
+		ASSERT_GE(allocations, 1u);
+
+		// set of distinct is created with its holder by the resource even if stream is empty
+		auto none = Stream(vector<int>()) | with_resource(&resource) | distinct() | count();
+		ASSERT_EQ(none, 0u);
+		ASSERT_EQ(resource.allocations(), allocations + 1);
+
+		auto unique = Stream(vec)
+			| with_resource(&resource)
+			| distinct()
+			| multi(to_vector(), count());
+		ASSERT_EQ(std::get<0>(unique), std::pmr::vector<int>({ 3, 1, 2 }));
+		ASSERT_EQ(std::get<0>(unique).get_allocator().resource(), &resource);
+		ASSERT_GE(resource.allocations(), allocations + 5);
+	}
+
+	TEST(Stream_WithResource, current_element_allocation_is_reused) {
+		CountingResource resource;
+		vector<string> strings = { "a", "b", "c", "", "d" };
+
+		auto taken = Stream(strings)
+			| with_resource(&resource)
+			| take_while([](string const & str) { return !str.empty(); })
+			| count();
+		ASSERT_EQ(taken, 3u);
+		// holder of current element is allocated once, not per element
+		const size_t allocations = resource.allocations();
+		ASSERT_EQ(allocations, 1u);
+
+		auto dropped = Stream(strings)
+			| with_resource(&resource)
+			| drop_while([](string const & str) { return !str.empty(); })
+			| filter([](string const & str) { return str != "x"; })
+			| count();
+		ASSERT_EQ(dropped, 2u);
+		// one holder for drop_while and one for filter
+		ASSERT_EQ(resource.allocations(), allocations + 2);
+	}
+
+	TEST(Stream_WithResource, nearest_resource_and_plain_streams) {
+		CountingResource first;
+		CountingResource second;
+		vector<int> vec = { 1, 2, 3 };
+
+		auto stream = Stream(vec) | with_resource(&first) | map([](int a) { return a; }) | with_resource(&second);
+		ASSERT_EQ(stream.memoryResource(), &second);
+		auto res = stream | to_vector();
+		ASSERT_EQ(res.get_allocator().resource(), &second);
+		ASSERT_EQ(first.allocations(), 0u);
+
+		// without resource types are not changed
+		auto plain = Stream(vec) | group_by_vector(2) | to_vector();
+		static_assert(std::is_same_v<decltype(plain), vector<vector<int> > >);
+
+		ASSERT_ANY_THROW(with_resource(nullptr));
+	}
+
+	TEST(Stream_WithResource, buffering_operators) {
+		CountingResource resource;
+		vector<int> vec = { 5, 3, 1, 4, 2 };
+
+		auto groups = Stream(vec)
+			| with_resource(&resource)
+			| group_by_span<GroupOwnership::MoveOut>(2)
+			| to_vector();
+		static_assert(std::is_same_v<decltype(groups)::value_type, std::pmr::vector<int> >);
+		ASSERT_EQ(groups.size(), 3u);
+		ASSERT_EQ(groups[0].get_allocator().resource(), &resource);
+		size_t allocations = resource.allocations();
+		ASSERT_GE(allocations, 4u);
+
+		auto views = Stream(vec)
+			| with_resource(&resource)
+			| group_by_span(2)
+			| map([](auto part) { return part.front(); })
+			| sum();
+		ASSERT_EQ(views, 5 + 1 + 2);
+		ASSERT_GT(resource.allocations(), allocations);
+		allocations = resource.allocations();
+
+		auto reversed = Stream(vec) | with_resource(&resource) | filter([](int) { return true; }) | reverse() | nth(0);
+		ASSERT_EQ(reversed, 2);
+		// outer vector of chunks and the chunk (filter keeps int inline, it is here to force buffering)
+		ASSERT_EQ(resource.allocations(), allocations + 2);
+		allocations = resource.allocations();
+
+		auto sorted = Stream(vec) | with_resource(&resource) | sorted_radix([](int a) { return a; }) | to_vector();
+		ASSERT_EQ(sorted, std::pmr::vector<int>({ 1, 2, 3, 4, 5 }));
+		// buffer of elements, histograms, offsets, scatter buffer and the result
+		ASSERT_GE(resource.allocations(), allocations + 5);
+		allocations = resource.allocations();
+
+		auto cached = Stream(vec) | with_resource(&resource) | cache();
+		auto firstSum = cached | sum();
+		auto secondSum = cached | sum();
+		ASSERT_EQ(firstSum, 15);
+		ASSERT_EQ(secondSum, 15);
+		ASSERT_GT(resource.allocations(), allocations);
+	}
+
+	TEST(Stream_WithResource, join_and_parallel_map) {
+		CountingResource resource;
+		vector<int> left = { 1, 2, 3 };
+		vector<int> right = { 2, 3, 3, 4 };
+
+		auto joined = Stream(left)
+			| with_resource(&resource)
+			| join_on(Stream(right), [](int a) { return a; }, [](int a) { return a; })
+			| count();
+		ASSERT_EQ(joined, 3u);
+		size_t allocations = resource.allocations();
+		// buckets and nodes of hash table
+		ASSERT_GE(allocations, 5u);
+
+		auto doubled = Stream(left)
+			| with_resource(&resource)
+			| parallel_map([](int a) { return 2 * a; }, 2)
+			| to_vector();
+		ASSERT_EQ(doubled, std::pmr::vector<int>({ 2, 4, 6 }));
+		// shared state, its ring buffers, worker pool and its threads, result
+		ASSERT_GE(resource.allocations(), allocations + 6);
+
+		// copy of started stream copies results in flight by the same resource
+		auto stream = Stream(left) | with_resource(&resource) | parallel_map([](int a) { return a; }, 2, 2);
+		ASSERT_EQ(stream.nextElem(), 1);
+		allocations = resource.allocations();
+		auto copy = stream;
+		ASSERT_EQ(copy | to_vector(), std::pmr::vector<int>({ 2, 3 }));
+		ASSERT_GT(resource.allocations(), allocations);
+	}
+
+	TEST(Stream_WithResource, terminated_operators) {
+		CountingResource resource;
+		vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+
+		auto picked = Stream(vec) | with_resource(&resource) | sample(3, 7);
+		static_assert(std::is_same_v<decltype(picked), std::pmr::vector<int> >);
+		ASSERT_EQ(picked.size(), 3u);
+		ASSERT_EQ(picked.get_allocator().resource(), &resource);
+
+		auto [odd, even] = Stream(vec) | with_resource(&resource) | partition_to([](int a) { return a % 2 == 1; });
+		static_assert(std::is_same_v<decltype(odd), std::pmr::vector<int> >);
+		ASSERT_EQ(odd, std::pmr::vector<int>({ 1, 3, 5 }));
+		ASSERT_EQ(even.get_allocator().resource(), &resource);
+
+		size_t allocations = resource.allocations();
+		auto statistics = Stream(vec) | with_resource(&resource) | stats();
+		ASSERT_EQ(statistics.count(), 6u);
+		ASSERT_EQ(statistics.sketch().get_allocator().resource(), &resource);
+		ASSERT_GT(resource.allocations(), allocations);
+
+		// the same inside multi
+		auto [parts, sketched] = Stream(vec)
+			| with_resource(&resource)
+			| multi(partition_to([](int a) { return a > 3; }), stats());
+		ASSERT_EQ(parts.first.get_allocator().resource(), &resource);
+		ASSERT_EQ(sketched.sketch().get_allocator().resource(), &resource);
+	}
+
+	TEST(Stream_WithResource, buffering_operators_without_default_allocations) {
+		// histograms of sorted_radix take 10 KB
+		static std::byte buffer[1 << 16];
+		std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+		vector<int> vec = { 5, 3, 1, 4, 2, 6 };
+
+		DefaultResourceGuard guard;
+		auto res = Stream(vec)
+			| with_resource(&arena)
+			| sorted_radix([](int a) { return a; })
+			| reverse()
+			| group_by_span<GroupOwnership::MoveOut>(4)
+			| map([](auto const & part) { return part.size(); })
+			| to_vector();
+		ASSERT_EQ(res.size(), 2u);
+		ASSERT_EQ(res[0], 4u);
+		ASSERT_EQ(res[1], 2u);
+
+		auto [high, low] = Stream(vec)
+			| with_resource(&arena)
+			| join_on(Stream(vec), [](int a) { return a; }, [](int a) { return a; })
+			| map([](auto const & pair) { return pair.first; })
+			| partition_to([](int a) { return a > 3; });
+		ASSERT_EQ(high.size(), 3u);
+		ASSERT_EQ(low.size(), 3u);
+
+		auto picked = Stream(vec) | with_resource(&arena) | sample(2, 1);
+		ASSERT_EQ(picked.size(), 2u);
+		auto statistics = Stream(vec) | with_resource(&arena) | stats();
+		ASSERT_EQ(statistics.count(), 6u);
+	}
+
+}
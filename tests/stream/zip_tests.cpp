@@ -0,0 +1,105 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "stream/stream.h"
+
+namespace stream_tests {
+
+	using std::cout;
+	using std::endl;
+	using std::vector;
+	using std::string;
+	using std::tuple;
+
+	using namespace lipaboy_lib;
+
+	using namespace lipaboy_lib::stream_space;
+	using namespace lipaboy_lib::stream_space::operators;
+
+	//---------------------------------Tests-------------------------------//
+
+	TEST(Stream_Zip, three_streams) {
+		vector<int> first = { 1, 2, 3, 4 };
+		vector<string> second = { "a", "b", "c" };
+		vector<double> third = { 0.5, 1.5, 2.5, 3.5, 4.5 };
+
+		auto res = zip(Stream(first), Stream(second), Stream(third)) | to_vector();
+
+		ASSERT_EQ(res, (vector<tuple<int, string, double> >({
+			{ 1, "a", 0.5 }, { 2, "b", 1.5 }, { 3, "c", 2.5 } })));
+	}
+
+	TEST(Stream_Zip, infinite_with_finite) {
+		int a = 0;
+		vector<int> vec = { 10, 20, 30 };
+		// zip is finite because one of the streams is finite
+		auto res = zip(Stream([&a]() { return a++; }), Stream(vec))
+			| map([](auto const & elems) { return std::get<0>(elems) + std::get<1>(elems); })
+			| to_vector();
+
+		ASSERT_EQ(res, vector<int>({ 10, 21, 32 }));
+	}
+
+	TEST(Stream_Zip, skipping_does_not_materialize) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+		auto counted = Stream(vec) | map([&calls](int elem) { calls++; return elem; });
+
+		auto res = zip(Stream(1, 2, 3, 4, 5, 6), counted) | skip(4) | to_vector();
+
+		ASSERT_EQ(res, (vector<tuple<int, int> >({ { 5, 5 }, { 6, 6 } })));
+		ASSERT_EQ(calls, 2);
+	}
+
+	TEST(Stream_Zip, count_and_filter) {
+		vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+		auto amount = zip(Stream(vec), Stream(vec) | map([](int a) { return a * a; }))
+			| filter([](auto const & elems) { return std::get<1>(elems) > 10; })
+			| count();
+		ASSERT_EQ(amount, 3u);
+	}
+
+	TEST(Stream_Zip, random_access) {
+		vector<int> first = { 1, 2, 3, 4, 5 };
+		vector<string> second = { "a", "b", "c", "d" };
+		vector<double> third = { 0.5, 1.5, 2.5, 3.5, 4.5, 5.5 };
+
+		auto makeZipped = [&]() { return zip(Stream(first), Stream(second), Stream(third)); };
+		auto zipped = makeZipped();
+		static_assert(decltype(zipped)::isRandomAccess());
+		ASSERT_EQ(zipped.restSize(), 4u);
+		ASSERT_EQ(makeZipped() | count(), 4u);
+		ASSERT_EQ(makeZipped() | skip(2) | to_vector(),
+			(vector<tuple<int, string, double> >({ { 3, "c", 2.5 }, { 4, "d", 3.5 } })));
+		ASSERT_EQ(makeZipped() | nth(3), (tuple<int, string, double>(4, "d", 3.5)));
+		ASSERT_FALSE((makeZipped() | nth(4)).has_value());
+
+		// advancing is clamped by every stream
+		zipped.advanceSlider(10);
+		ASSERT_EQ(zipped.restSize(), 0u);
+		ASSERT_FALSE(zipped.hasNext());
+
+		// stream that isn't a random access source makes zip sequential
+		auto mapped = zip(Stream(first), Stream(first) | map([](int a) { return a; }));
+		static_assert(!decltype(mapped)::isRandomAccess());
+		ASSERT_EQ(mapped | count(), 5u);
+		auto unbounded = zip(Stream(first), Stream([]() { return 0; }));
+		static_assert(!decltype(unbounded)::isRandomAccess());
+	}
+
+	TEST(Stream_Paired, skipping_does_not_materialize) {
+		int calls = 0;
+		vector<int> vec = { 1, 2, 3 };
+		auto counted = Stream(vec) | map([&calls](int elem) { calls++; return elem; });
+
+		auto amount = (Stream(vec) & counted) | count();
+
+		EXPECT_EQ(amount, 3u);
+		ASSERT_EQ(calls, 0);
+	}
+
+}